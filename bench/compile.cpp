@@ -0,0 +1,442 @@
+// Compile pipeline benchmark for the slangc wrapper.
+//
+// Times global session creation, session creation, module load, entry point lookup,
+// link and code generation for the demo shaders and a generated synthetic corpus:
+//   SynthDeepImport       - an entry point at the end of a long import chain
+//   SynthManyEntryPoints  - one module with thousands of compute entry points
+//   SynthLargeCBuffer     - an entry point reading a constant buffer with many fields
+// Each phase is measured per target (SPIR-V, GLSL, HLSL, C++) over several repeats and
+// reported as min/mean/percentiles, on stdout and optionally as JSON.
+//
+// Usage: slangc-bench [options]
+//   --repeat N             Repeats of the whole run (default 5)
+//   --json PATH            Write results as JSON
+//   --shader-dir DIR       Directory holding the demo shaders
+//   --corpus-dir DIR       Directory to generate the synthetic corpus in
+//   --import-depth N       Modules in the import chain (default 64)
+//   --entry-points N       Entry points in the many-entry-point module (default 2000)
+//   --codegen-samples N    Entry points of that module to generate code for (default 16)
+//   --cbuffer-fields N     Fields in the large constant buffer (default 1024)
+
+#include "slangc.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifndef SLANGC_BENCH_SHADER_DIR
+#define SLANGC_BENCH_SHADER_DIR "demo/shaders"
+#endif
+
+namespace
+{
+    struct Options
+    {
+        int repeat = 5;
+        std::string jsonPath;
+        std::string shaderDir = SLANGC_BENCH_SHADER_DIR;
+        std::string corpusDir = "slangc-bench-corpus";
+        int importDepth = 64;
+        int entryPointCount = 2000;
+        int codegenSamples = 16;
+        int cbufferFields = 1024;
+    };
+
+    struct EntryPoint
+    {
+        std::string name;
+        SlangcStage stage;
+        bool generateCode; // Entry points of large modules are only partly sampled
+    };
+
+    struct Workload
+    {
+        std::string name; // Module name, found through the search paths
+        std::vector<EntryPoint> entryPoints;
+    };
+
+    struct BenchTarget
+    {
+        const char *name;
+        SlangcCompileTarget target;
+    };
+
+    const BenchTarget kTargets[] = {
+        {"spirv", SLANGC_TARGET_SPIRV},
+        {"glsl", SLANGC_TARGET_GLSL},
+        {"hlsl", SLANGC_TARGET_HLSL},
+        {"cpp", SLANGC_TARGET_CPP_SOURCE},
+    };
+
+    // Samples in milliseconds, keyed by (workload, target, phase)
+    using SampleKey = std::tuple<std::string, std::string, std::string>;
+
+    struct Results
+    {
+        std::map<SampleKey, std::vector<double>> samples;
+        std::map<SampleKey, int> failures;
+
+        void add(const std::string &workload, const std::string &target, const char *phase, double ms)
+        {
+            samples[{workload, target, phase}].push_back(ms);
+        }
+
+        void fail(const std::string &workload, const std::string &target, const char *phase)
+        {
+            failures[{workload, target, phase}]++;
+        }
+    };
+
+    struct Summary
+    {
+        size_t count;
+        double min, mean, p50, p90, p99, max;
+    };
+
+    // Nearest-rank percentile of sorted samples
+    double percentile(const std::vector<double> &sorted, double fraction)
+    {
+        size_t rank = static_cast<size_t>(fraction * sorted.size() + 0.999999);
+        return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+    }
+
+    Summary summarize(std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        double total = 0.0;
+        for (double sample : samples)
+            total += sample;
+        return {samples.size(), samples.front(), total / samples.size(),
+                percentile(samples, 0.50), percentile(samples, 0.90), percentile(samples, 0.99), samples.back()};
+    }
+
+    class Stopwatch
+    {
+    public:
+        Stopwatch() : m_start(std::chrono::steady_clock::now()) {}
+
+        double elapsedMs() const
+        {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    bool writeFile(const std::filesystem::path &path, const std::string &text)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << text;
+        return static_cast<bool>(file);
+    }
+
+    const char *kComputeHeader = "[shader(\"compute\")]\n[numthreads(64, 1, 1)]\n";
+
+    // Writes the synthetic modules and returns their workloads
+    bool generateCorpus(const Options &options, std::vector<Workload> &outWorkloads)
+    {
+        std::filesystem::path dir(options.corpusDir);
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+
+        // Deep import chain: chain_i imports chain_(i-1)
+        for (int i = 0; i < options.importDepth; i++)
+        {
+            std::string source;
+            if (i > 0)
+                source += "import chain_" + std::to_string(i - 1) + ";\n\n";
+            source += "float chain_" + std::to_string(i) + "(float x)\n{\n    return ";
+            source += i > 0 ? "chain_" + std::to_string(i - 1) + "(x) * 1.0001 + " + std::to_string(i) + ".0" : "x";
+            source += ";\n}\n";
+            if (!writeFile(dir / ("chain_" + std::to_string(i) + ".slang"), source))
+                return false;
+        }
+        std::string last = "chain_" + std::to_string(std::max(0, options.importDepth - 1));
+        std::string deep = "import " + last + ";\n\nRWStructuredBuffer<float> output;\n\n" + kComputeHeader +
+                           "void deepMain(uint3 id : SV_DispatchThreadID)\n{\n    output[id.x] = " + last +
+                           "(float(id.x));\n}\n";
+        if (!writeFile(dir / "SynthDeepImport.slang", deep))
+            return false;
+        outWorkloads.push_back({"SynthDeepImport", {{"deepMain", SLANGC_STAGE_COMPUTE, true}}});
+
+        // Many entry points in one module
+        Workload many = {"SynthManyEntryPoints", {}};
+        std::string manySource = "RWStructuredBuffer<float> output;\n";
+        int sampleStride = std::max(1, options.entryPointCount / std::max(1, options.codegenSamples));
+        for (int i = 0; i < options.entryPointCount; i++)
+        {
+            std::string name = "entry_" + std::to_string(i);
+            manySource += std::string("\n") + kComputeHeader + "void " + name +
+                          "(uint3 id : SV_DispatchThreadID)\n{\n    output[id.x] = float(id.x) * " +
+                          std::to_string(i) + ".0;\n}\n";
+            many.entryPoints.push_back({name, SLANGC_STAGE_COMPUTE, i % sampleStride == 0});
+        }
+        if (!writeFile(dir / "SynthManyEntryPoints.slang", manySource))
+            return false;
+        outWorkloads.push_back(std::move(many));
+
+        // Large constant buffer
+        std::string cbuffer = "cbuffer LargeConstants\n{\n";
+        for (int i = 0; i < options.cbufferFields; i++)
+            cbuffer += "    float4 field_" + std::to_string(i) + ";\n";
+        cbuffer += "};\n\nRWStructuredBuffer<float4> output;\n\n" + std::string(kComputeHeader) +
+                   "void cbufferMain(uint3 id : SV_DispatchThreadID)\n{\n    float4 sum = float4(0.0);\n";
+        for (int i = 0; i < options.cbufferFields; i++)
+            cbuffer += "    sum += field_" + std::to_string(i) + ";\n";
+        cbuffer += "    output[id.x] = sum;\n}\n";
+        if (!writeFile(dir / "SynthLargeCBuffer.slang", cbuffer))
+            return false;
+        outWorkloads.push_back({"SynthLargeCBuffer", {{"cbufferMain", SLANGC_STAGE_COMPUTE, true}}});
+
+        return true;
+    }
+
+    // Loads the workload's module and times every phase after session creation
+    void runWorkload(SlangcSession *session, const BenchTarget &target, const Workload &workload, Results &results)
+    {
+        Stopwatch loadTimer;
+        SlangcModule *module = slangc_loadModule(session, workload.name.c_str(), nullptr);
+        if (!module)
+        {
+            results.fail(workload.name, target.name, "loadModule");
+            return;
+        }
+        results.add(workload.name, target.name, "loadModule", loadTimer.elapsedMs());
+
+        std::vector<SlangcEntryPoint *> entryPoints;
+        Stopwatch findTimer;
+        for (const auto &entry : workload.entryPoints)
+        {
+            if (SlangcEntryPoint *entryPoint = slangc_findEntryPoint(module, entry.name.c_str(), entry.stage, nullptr))
+                entryPoints.push_back(entryPoint);
+        }
+        if (entryPoints.size() != workload.entryPoints.size())
+            results.fail(workload.name, target.name, "findEntryPoints");
+        else
+            results.add(workload.name, target.name, "findEntryPoints", findTimer.elapsedMs());
+
+        // Link one program holding the module and every entry point
+        std::vector<SlangcComponentType> components(entryPoints.size() + 1);
+        components[0].kind = SLANGC_COMPONENT_TYPE_MODULE;
+        components[0].module = module;
+        for (size_t i = 0; i < entryPoints.size(); i++)
+        {
+            components[i + 1].kind = SLANGC_COMPONENT_TYPE_ENTRY_POINT;
+            components[i + 1].entryPoint = entryPoints[i];
+        }
+
+        Stopwatch linkTimer;
+        SlangcComponentType *program = slangc_createCompositeComponentType(
+            session, components.data(), static_cast<int32_t>(components.size()), nullptr);
+        SlangcComponentType *linkedProgram = program ? slangc_linkComponentType(program, nullptr) : nullptr;
+        if (linkedProgram)
+            results.add(workload.name, target.name, "link", linkTimer.elapsedMs());
+        else
+            results.fail(workload.name, target.name, "link");
+
+        // Entry point indices only match the workload when every lookup succeeded
+        bool allFound = entryPoints.size() == workload.entryPoints.size();
+        for (size_t i = 0; linkedProgram && allFound && i < workload.entryPoints.size(); i++)
+        {
+            if (!workload.entryPoints[i].generateCode)
+                continue;
+
+            Stopwatch codegenTimer;
+            SlangcBlob *code = slangc_getEntryPointCode(linkedProgram, static_cast<int32_t>(i), 0, nullptr);
+            if (code)
+                results.add(workload.name, target.name, "codegen", codegenTimer.elapsedMs());
+            else
+                results.fail(workload.name, target.name, "codegen");
+            slangc_releaseBlob(code);
+        }
+
+        slangc_releaseComponentType(linkedProgram);
+        slangc_releaseComponentType(program);
+        for (SlangcEntryPoint *entryPoint : entryPoints)
+            slangc_releaseEntryPoint(entryPoint);
+        slangc_releaseModule(module);
+    }
+
+    bool runOnce(const Options &options, const std::vector<Workload> &workloads, Results &results)
+    {
+        Stopwatch globalTimer;
+        SlangcGlobalSession *globalSession = slangc_createGlobalSession();
+        if (!globalSession)
+        {
+            std::fprintf(stderr, "Failed to create global session: %s\n", slangc_getLastError());
+            return false;
+        }
+        results.add("*", "*", "globalSession", globalTimer.elapsedMs());
+
+        const char *searchPaths[] = {options.shaderDir.c_str(), options.corpusDir.c_str()};
+        for (const auto &target : kTargets)
+        {
+            SlangcCompileTarget compileTarget = target.target;
+            SlangcSessionDesc desc = {};
+            desc.targets = &compileTarget;
+            desc.targetCount = 1;
+            desc.searchPaths = searchPaths;
+            desc.searchPathCount = 2;
+
+            // A fresh session per workload, so no module is already loaded
+            for (const auto &workload : workloads)
+            {
+                Stopwatch sessionTimer;
+                SlangcSession *session = slangc_createSession(globalSession, &desc);
+                if (!session)
+                {
+                    results.fail(workload.name, target.name, "session");
+                    continue;
+                }
+                results.add(workload.name, target.name, "session", sessionTimer.elapsedMs());
+
+                runWorkload(session, target, workload, results);
+                slangc_releaseSession(session);
+            }
+        }
+
+        slangc_releaseGlobalSession(globalSession);
+        return true;
+    }
+
+    void printResults(const Results &results)
+    {
+        std::printf("%-22s %-6s %-16s %7s %10s %10s %10s %10s %10s %10s\n",
+                    "workload", "target", "phase", "samples", "min ms", "mean ms", "p50 ms", "p90 ms", "p99 ms", "max ms");
+        for (const auto &[key, samples] : results.samples)
+        {
+            Summary summary = summarize(samples);
+            std::printf("%-22s %-6s %-16s %7zu %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n",
+                        std::get<0>(key).c_str(), std::get<1>(key).c_str(), std::get<2>(key).c_str(), summary.count,
+                        summary.min, summary.mean, summary.p50, summary.p90, summary.p99, summary.max);
+        }
+        for (const auto &[key, count] : results.failures)
+        {
+            std::printf("%-22s %-6s %-16s %d failure(s)\n",
+                        std::get<0>(key).c_str(), std::get<1>(key).c_str(), std::get<2>(key).c_str(), count);
+        }
+    }
+
+    bool writeJson(const Options &options, const Results &results)
+    {
+        std::ofstream file(options.jsonPath, std::ios::trunc);
+        file << "{\n  \"wrapperVersion\": \"" << slangc_getVersionString() << "\",\n";
+        file << "  \"repeat\": " << options.repeat << ",\n  \"results\": [";
+
+        // Rows that failed on every repeat have no samples but are still reported
+        std::set<SampleKey> keys;
+        for (const auto &entry : results.samples)
+            keys.insert(entry.first);
+        for (const auto &entry : results.failures)
+            keys.insert(entry.first);
+
+        bool first = true;
+        for (const SampleKey &key : keys)
+        {
+            auto samples = results.samples.find(key);
+            auto failure = results.failures.find(key);
+            file << (first ? "\n" : ",\n");
+            first = false;
+            file << "    {\"workload\": \"" << std::get<0>(key) << "\", \"target\": \"" << std::get<1>(key)
+                 << "\", \"phase\": \"" << std::get<2>(key) << "\", \"samples\": "
+                 << (samples != results.samples.end() ? samples->second.size() : 0)
+                 << ", \"failures\": " << (failure != results.failures.end() ? failure->second : 0);
+            if (samples != results.samples.end())
+            {
+                Summary summary = summarize(samples->second);
+                file << ", \"minMs\": " << summary.min << ", \"meanMs\": " << summary.mean
+                     << ", \"p50Ms\": " << summary.p50 << ", \"p90Ms\": " << summary.p90
+                     << ", \"p99Ms\": " << summary.p99 << ", \"maxMs\": " << summary.max;
+            }
+            file << "}";
+        }
+        file << "\n  ]\n}\n";
+        return static_cast<bool>(file);
+    }
+
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const char *arg = argv[i];
+            const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+            auto takeInt = [&](int &out)
+            {
+                out = std::max(1, std::atoi(value));
+                i++;
+            };
+
+            if (!value)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", arg);
+                return false;
+            }
+            if (std::strcmp(arg, "--repeat") == 0)
+                takeInt(options.repeat);
+            else if (std::strcmp(arg, "--import-depth") == 0)
+                takeInt(options.importDepth);
+            else if (std::strcmp(arg, "--entry-points") == 0)
+                takeInt(options.entryPointCount);
+            else if (std::strcmp(arg, "--codegen-samples") == 0)
+                takeInt(options.codegenSamples);
+            else if (std::strcmp(arg, "--cbuffer-fields") == 0)
+                takeInt(options.cbufferFields);
+            else if (std::strcmp(arg, "--json") == 0)
+                options.jsonPath = argv[++i];
+            else if (std::strcmp(arg, "--shader-dir") == 0)
+                options.shaderDir = argv[++i];
+            else if (std::strcmp(arg, "--corpus-dir") == 0)
+                options.corpusDir = argv[++i];
+            else
+            {
+                std::fprintf(stderr, "Unknown option %s\n", arg);
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return 1;
+
+    std::vector<Workload> workloads = {
+        {"VertexDemo", {{"vertexMain", SLANGC_STAGE_VERTEX, true}, {"fragmentMain", SLANGC_STAGE_FRAGMENT, true}}},
+        {"ComputeDemo", {{"computeMain", SLANGC_STAGE_COMPUTE, true}}},
+    };
+    if (!generateCorpus(options, workloads))
+    {
+        std::fprintf(stderr, "Failed to generate the synthetic corpus in %s\n", options.corpusDir.c_str());
+        return 1;
+    }
+
+    Results results;
+    for (int i = 0; i < options.repeat; i++)
+    {
+        if (!runOnce(options, workloads, results))
+            return 1;
+    }
+
+    printResults(results);
+    if (!options.jsonPath.empty() && !writeJson(options, results))
+    {
+        std::fprintf(stderr, "Failed to write %s\n", options.jsonPath.c_str());
+        return 1;
+    }
+
+    slangc_shutdown();
+    return 0;
+}
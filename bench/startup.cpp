@@ -0,0 +1,102 @@
+// Startup benchmark for the slangc wrapper.
+//
+// Compares global session creation when the core module is built from scratch
+// against creation from a core module snapshot (SlangcGlobalSessionDesc::coreModuleSnapshotPath).
+//
+// Usage: slangc-bench-startup [snapshot-path] [iterations]
+
+#include "slangc.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <vector>
+
+namespace
+{
+    struct Timings
+    {
+        std::vector<double> samples;
+
+        double min() const { return *std::min_element(samples.begin(), samples.end()); }
+        double max() const { return *std::max_element(samples.begin(), samples.end()); }
+        double mean() const
+        {
+            double total = 0.0;
+            for (double sample : samples)
+                total += sample;
+            return total / samples.size();
+        }
+    };
+
+    // Returns the creation time in milliseconds, or a negative value on failure
+    double timeGlobalSessionCreation(const char *snapshotPath)
+    {
+        SlangcGlobalSessionDesc desc = {};
+        desc.coreModuleSnapshotPath = snapshotPath;
+
+        auto start = std::chrono::steady_clock::now();
+        SlangcGlobalSession *globalSession = slangc_createGlobalSessionWithDesc(&desc);
+        auto end = std::chrono::steady_clock::now();
+
+        if (!globalSession)
+        {
+            std::fprintf(stderr, "Failed to create global session: %s\n", slangc_getLastError());
+            return -1.0;
+        }
+        slangc_releaseGlobalSession(globalSession);
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    bool measure(const char *label, const char *snapshotPath, int iterations, Timings &outTimings)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            double ms = timeGlobalSessionCreation(snapshotPath);
+            if (ms < 0.0)
+                return false;
+            outTimings.samples.push_back(ms);
+        }
+
+        std::printf("%-10s min %9.2f ms   mean %9.2f ms   max %9.2f ms   (%d runs)\n",
+                    label, outTimings.min(), outTimings.mean(), outTimings.max(), iterations);
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *snapshotPath = argc > 1 ? argv[1] : "slangc-core-module.snapshot";
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+
+    std::error_code ec;
+    std::filesystem::remove(snapshotPath, ec);
+
+    Timings cold;
+    if (!measure("cold", nullptr, iterations, cold))
+        return 1;
+
+    // The first snapshot run builds the core module and writes the snapshot
+    double firstRun = timeGlobalSessionCreation(snapshotPath);
+    if (firstRun < 0.0)
+        return 1;
+    if (!std::filesystem::exists(snapshotPath, ec))
+    {
+        std::fprintf(stderr, "Snapshot was not written to %s\n", snapshotPath);
+        return 1;
+    }
+    std::printf("%-10s %13.2f ms   (builds and saves snapshot, %llu bytes)\n", "save",
+                firstRun, static_cast<unsigned long long>(std::filesystem::file_size(snapshotPath, ec)));
+
+    Timings snapshot;
+    if (!measure("snapshot", snapshotPath, iterations, snapshot))
+        return 1;
+
+    std::printf("speedup    %9.2fx (mean)\n", cold.mean() / snapshot.mean());
+
+    slangc_shutdown();
+    return 0;
+}
@@ -83,7 +83,7 @@ main :: proc() {
 
 	slang.releaseBlob(codeBlob)
 
-	codeBlob = slang.getEntryPointCode(linkedProgram, 0, 0, nil)
+	codeBlob = slang.getEntryPointCode(linkedProgram, 1, 0, nil)
 	if codeBlob == nil {
 		panic("Failed to get entry point code\n")
 	}
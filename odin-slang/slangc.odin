@@ -21,20 +21,22 @@ else {
     }
 }
 
-// Component type - can be either a module, entry point, or composite
+// Component type - can be a module, entry point, composite, or type conformance
 Component_Type_Kind :: enum c.int {
 	MODULE,
 	ENTRY_POINT,
 	COMPOSITE,
+	TYPE_CONFORMANCE,
 }
 
 // Component type struct - exposed so users can access it directly
 Component_Type :: struct {
 	kind: Component_Type_Kind,
 	using _: struct #raw_union {
-		module:     ^Module,
-		entryPoint: ^Entry_Point,
-		composite:  rawptr, // Opaque pointer to internal composite type
+		module:          ^Module,
+		entryPoint:      ^Entry_Point,
+		composite:       rawptr, // Opaque pointer to internal composite type
+		typeConformance: ^Type_Conformance,
 	},
 }
 
@@ -47,8 +49,32 @@ Module :: struct {}
 
 Entry_Point :: struct {}
 
+Type_Conformance :: struct {}
+
+Host_Callable :: struct {}
+
+Compute_Dispatcher :: struct {}
+
+Dependency_Graph :: struct {}
+
+Hot_Reload :: struct {}
+
 Blob :: struct {}
 
+Cache :: struct {}
+
+Session_Pool :: struct {}
+
+Compile_Executor :: struct {}
+
+Compile_Ticket :: struct {}
+
+Compile_Server :: struct {}
+
+File_System :: struct {}
+
+Profile :: struct {}
+
 OK :: 0
 
 // Result codes (still useful for some functions)
@@ -130,19 +156,378 @@ Matrix_Layout_Mode :: enum c.int {
 Session_Desc :: struct {
 	targets:                [^]Compile_Target,
 	targetCount:            i32,
-	searchPaths:            [^]cstring,
+	searchPaths:            [^]cstring, // Paths searched for imported modules and includes
 	searchPathCount:        i32,
-	preprocessorMacros:     [^]cstring,
+	preprocessorMacros:     [^]cstring, // Macros as "NAME" or "NAME=VALUE"
 	preprocessorMacroCount: i32,
 	matrixLayoutMode:       Matrix_Layout_Mode,
+	cache:                  ^Cache,       // Optional compiled-code cache (can be NULL)
+	fileSystem:             ^File_System, // Optional file system for source loading (NULL for Slang's default)
+	timingProfile:          ^Profile,     // Optional timing profile to record calls into (can be NULL)
+	generateWholeProgram:   bool,         // Generate one module per target holding every entry point (see slangc_getTargetCode)
 }
 
 // Global session description
 Global_Session_Desc :: struct {
-	apiVersion:      u32,
-	searchPaths:     [^]cstring,
-	searchPathCount: i32,
-	enableGLSL:      bool,
+	apiVersion:             u32,
+	searchPaths:            [^]cstring,
+	searchPathCount:        i32,
+	enableGLSL:             bool,
+	coreModuleSnapshotPath: cstring, // Core module snapshot file (can be NULL to always build the core module)
+}
+
+// Session pool description
+Session_Pool_Desc :: struct {
+	maxGlobalSessions: i32,                  // Upper bound on global sessions (0 for one per hardware thread)
+	globalSessionDesc: ^Global_Session_Desc, // Settings for each global session (can be NULL for defaults)
+}
+
+// Compiled-code cache description
+Cache_Desc :: struct {
+	directory:    cstring, // Directory holding cache entries (created if missing)
+	maxSizeBytes: u64,     // Size cap before least recently used entries are evicted (0 for no cap)
+	cacheModules: bool,    // Also keep checked modules loaded through slangc_loadModule
+}
+
+// File system description
+File_System_Desc :: struct {
+	archivePath:    cstring, // Packed archive to serve files from (can be NULL)
+	disableOSFiles: bool,    // Serve only files found in the archive
+}
+
+// Wrapper calls timed by a profile
+Profile_Phase :: enum c.int {
+	LOAD_MODULE,          // slangc_loadModule and slangc_loadModuleFromSource*
+	FIND_ENTRY_POINT,     // slangc_findEntryPoint
+	CREATE_COMPOSITE,     // slangc_createCompositeComponentType
+	LINK,                 // slangc_linkComponentType
+	GET_ENTRY_POINT_CODE, // slangc_getEntryPointCode
+	GET_TARGET_CODE,      // slangc_getTargetCode
+	SPECIALIZE,           // slangc_specialize
+	GET_HOST_CALLABLE,    // slangc_getEntryPointHostCallable
+	COUNT,
+}
+
+// Accumulated timing of one phase
+Profile_Phase_Stats :: struct {
+	callCount:         u64,
+	wallSeconds:       f64, // Elapsed time inside the calls
+	cpuSeconds:        f64, // CPU time of the calling threads inside the calls
+	compilerSeconds:   f64, // Time Slang reports for itself, including downstream compilers
+	downstreamSeconds: f64, // Time Slang reports for downstream compilers such as DXC or glslang
+}
+
+// One entry of Slang's performance benchmark report
+Profile_Benchmark_Entry :: struct {
+	name:            cstring, // Slang function or pass name (valid until the profile is reset or released)
+	invocationCount: u64,
+	milliseconds:    f64,
+}
+
+// A single entry point compilation in a batch
+Compile_Job :: struct {
+	moduleName:             cstring,        // Module to load, as passed to slangc_loadModule
+	entryPointName:         cstring,        // Entry point function name
+	stage:                  Stage,          // Entry point stage
+	target:                 Compile_Target, // Code generation target
+	preprocessorMacros:     [^]cstring,     // Macros as "NAME" or "NAME=VALUE" (can be NULL)
+	preprocessorMacroCount: i32,
+	depfilePath:            cstring,        // Makefile depfile written after a successful compile (can be NULL)
+	outputPath:             cstring,        // Rule target named in the depfile (NULL for the entry point name)
+}
+
+// Result of a single batch job
+Compile_Job_Result :: struct {
+	result:      Result, // SLANGC_OK if code was produced
+	code:        ^Blob,  // Compiled code, or NULL on failure
+	diagnostics: ^Blob,  // Diagnostic messages, or NULL if there were none
+}
+
+// Batch compilation description
+Batch_Desc :: struct {
+	pool:             ^Session_Pool, // Pool to take global sessions from (NULL for a temporary pool)
+	threadCount:      i32,           // Worker threads (0 for one per hardware thread)
+	searchPaths:      [^]cstring,
+	searchPathCount:  i32,
+	matrixLayoutMode: Matrix_Layout_Mode,
+	cache:            ^Cache,       // Optional compiled-code cache (can be NULL)
+	fileSystem:       ^File_System, // Optional file system for source loading (NULL for Slang's default)
+	timingProfile:    ^Profile,     // Optional timing profile to record calls into (can be NULL)
+}
+
+// A preprocessor macro that takes one of several values in each permutation variant
+Macro_Dimension :: struct {
+	name:       cstring,    // Macro name
+	values:     [^]cstring, // Values to enumerate (a NULL value leaves the macro undefined)
+	valueCount: i32,
+}
+
+// Called for each enumerated variant with one value index per dimension; return
+// false to prune the variant
+Permutation_Filter :: proc "c" (valueIndices: [^]i32, dimensionCount: i32, userData: rawptr) -> bool
+
+// Permutation compilation description
+Permutation_Desc :: struct {
+	moduleName:             cstring,        // Module to load, as passed to slangc_loadModule
+	entryPointName:         cstring,        // Entry point function name
+	stage:                  Stage,          // Entry point stage
+	target:                 Compile_Target, // Code generation target
+	dimensions:             [^]Macro_Dimension,
+	dimensionCount:         i32,
+	preprocessorMacros:     [^]cstring, // Macros shared by every variant; a dimension replaces one of the same name (can be NULL)
+	preprocessorMacroCount: i32,
+	filter:                 Permutation_Filter, // Optional pruning rule (NULL to keep every variant)
+	filterUserData:         rawptr,
+}
+
+// Compiled permutation variants, with identical outputs stored once
+Permutation_Results :: struct {
+	variantCount:   i32, // Variants left after pruning
+	dimensionCount: i32,
+	valueIndices:   [^]i32,    // variantCount rows of dimensionCount value indices
+	results:        [^]Result, // Per variant result
+	blobIndices:    [^]i32,    // Per variant index into blobs, or -1 if the variant failed
+	diagnostics:    [^]^Blob,  // Per variant diagnostics (entries can be NULL)
+	blobCount:      i32,       // Number of unique outputs
+	blobs:          [^]^Blob,  // Unique compiled outputs
+}
+
+// Asynchronous compile executor description
+Compile_Executor_Desc :: struct {
+	pool:             ^Session_Pool, // Pool to take global sessions from (NULL for an executor-owned pool)
+	threadCount:      i32,           // Background threads (0 for one less than the hardware thread count)
+	searchPaths:      [^]cstring,
+	searchPathCount:  i32,
+	matrixLayoutMode: Matrix_Layout_Mode,
+	cache:            ^Cache,       // Optional compiled-code cache (can be NULL)
+	fileSystem:       ^File_System, // Optional file system for source loading (NULL for Slang's default)
+	timingProfile:    ^Profile,     // Optional timing profile to record calls into (can be NULL)
+}
+
+// State of an asynchronous compile
+Compile_Ticket_Status :: enum c.int {
+	PENDING = 0,
+	RUNNING,
+	SUCCEEDED,
+	FAILED,
+	CANCELLED,
+}
+
+// Called on an executor thread once a ticket has finished or was cancelled
+Compile_Callback :: proc "c" (ticket: ^Compile_Ticket, userData: rawptr)
+
+WAIT_INFINITE :: 0xFFFFFFFF
+
+// Compile server description
+Compile_Server_Desc :: struct {
+	socketPath:   cstring,       // Unix domain socket to listen on (NULL for the default, see slangc_compileBatchRemote)
+	pool:         ^Session_Pool, // Pool to take global sessions from (NULL for a server-owned pool)
+	threadCount:  i32,           // Compile threads for each set of session settings (0 for one per hardware thread)
+	cache:        ^Cache,        // Optional compiled-code cache (can be NULL)
+	maxExecutors: i32,           // Sets of session settings kept warm at once, least recently used evicted first (0 for 4)
+}
+
+// Compiled-code cache statistics
+Cache_Stats :: struct {
+	hitCount:        u64, // Entry point code served from the cache
+	missCount:       u64, // Entry point code that had to be generated
+	moduleHitCount:  u64, // Modules loaded from an up-to-date binary module
+	moduleMissCount: u64, // Modules that had to be checked from source
+	evictionCount:   u64,
+	entryCount:      u64,
+	totalSizeBytes:  u64,
+}
+
+// Compile server statistics
+Compile_Server_Stats :: struct {
+	requestCount:            u64, // Batches received from clients
+	jobCount:                u64, // Jobs in those batches
+	rejectedConnectionCount: u64, // Connections closed because the peer was another user
+}
+
+// Parameter resource categories (values match SlangParameterCategory)
+Parameter_Category :: enum c.int {
+	NONE = 0,
+	MIXED,
+	CONSTANT_BUFFER,
+	SHADER_RESOURCE,
+	UNORDERED_ACCESS,
+	VARYING_INPUT,
+	VARYING_OUTPUT,
+	SAMPLER_STATE,
+	UNIFORM,
+	DESCRIPTOR_TABLE_SLOT,
+	SPECIALIZATION_CONSTANT,
+	PUSH_CONSTANT_BUFFER,
+	REGISTER_SPACE,
+	GENERIC,
+	RAY_PAYLOAD,
+	HIT_ATTRIBUTES,
+	CALLABLE_PAYLOAD,
+	SHADER_RECORD,
+	EXISTENTIAL_TYPE_PARAM,
+	EXISTENTIAL_OBJECT_PARAM,
+	SUB_ELEMENT_REGISTER_SPACE,
+	SUBPASS,
+}
+
+// Descriptor binding types (values match SlangBindingType)
+Binding_Type :: enum c.int {
+	UNKNOWN = 0,
+	SAMPLER,
+	TEXTURE,
+	CONSTANT_BUFFER,
+	PARAMETER_BLOCK,
+	TYPED_BUFFER,
+	RAW_BUFFER,
+	COMBINED_TEXTURE_SAMPLER,
+	INPUT_RENDER_TARGET,
+	INLINE_UNIFORM_DATA,
+	RAY_TRACING_ACCELERATION_STRUCTURE,
+	VARYING_INPUT,
+	VARYING_OUTPUT,
+	EXISTENTIAL_VALUE,
+	PUSH_CONSTANT,
+	MUTABLE_FLAG = 0x100,
+	MUTABLE_TEXTURE = 0x102,
+	MUTABLE_TYPED_BUFFER = 0x105,
+	MUTABLE_RAW_BUFFER = 0x106,
+}
+
+// Type kinds (values match SlangTypeKind)
+Type_Kind :: enum c.int {
+	NONE = 0,
+	STRUCT,
+	ARRAY,
+	MATRIX,
+	VECTOR,
+	SCALAR,
+	CONSTANT_BUFFER,
+	RESOURCE,
+	SAMPLER_STATE,
+	TEXTURE_BUFFER,
+	SHADER_STORAGE_BUFFER,
+	PARAMETER_BLOCK,
+	GENERIC_TYPE_PARAMETER,
+	INTERFACE,
+	OUTPUT_STREAM,
+	MESH_OUTPUT,
+	SPECIALIZED,
+	FEEDBACK,
+	POINTER,
+	DYNAMIC_RESOURCE,
+}
+
+REFLECTION_MAGIC :: 0x46455253 // "SREF"
+REFLECTION_VERSION :: 2
+
+// Header of a reflection snapshot. The snapshot is one contiguous, pointer-free
+// buffer: every array field is a byte offset from the start of the header to an
+// array aligned to its element size (4 bytes, or 8 for hashes), and every string is
+// a byte offset into the string table of a null-terminated UTF-8 string. Entry
+// point indices of -1 mean global scope.
+//
+// Layout hashes are canonical: they cover the binding index, descriptor type and
+// count and stage mask of every range in a set, sorted by binding, and ignore
+// names and declaration order. Equal layoutHash values mean the programs can share
+// a pipeline layout.
+Reflection_Snapshot :: struct {
+	magic:             u32, // SLANGC_REFLECTION_MAGIC
+	version:           u32, // SLANGC_REFLECTION_VERSION
+	totalSize:         u32,
+	entryPointCount:   u32,
+	parameterCount:    u32,
+	bindingCount:      u32,
+	pushConstantCount: u32,
+	stringTableSize:   u32,
+	layoutHash:        u64, // Hash of every descriptor set layout and push-constant range
+	setCount:          u32, // Distinct descriptor sets used by the bindings
+
+	// Entry points
+	entryPointNames:            u32, // uint32_t string offsets
+	entryPointStages:           u32, // uint32_t SlangcStage
+	entryPointThreadGroupSizes: u32, // uint32_t[3] per entry point
+
+	// Top-level shader parameters, global then per entry point
+	parameterNames:         u32, // uint32_t string offsets
+	parameterTypeNames:     u32, // uint32_t string offsets
+	parameterTypeKinds:     u32, // uint32_t SlangcTypeKind
+	parameterCategories:    u32, // uint32_t SlangcParameterCategory
+	parameterEntryPoints:   u32, // int32_t entry point index
+	parameterSpaces:        u32, // uint32_t register space / descriptor set
+	parameterOffsets:       u32, // uint32_t offset in category units (bytes for uniforms)
+	parameterSizes:         u32, // uint32_t size in category units
+	parameterElementCounts: u32, // uint32_t array length (1 if not an array, 0 if unbounded)
+	parameterDataSizes:     u32, // uint32_t uniform bytes (buffer contents for constant buffers)
+
+	// Descriptor ranges, as used to build descriptor set layouts
+	bindingSets:             u32, // uint32_t descriptor set / register space
+	bindingIndices:          u32, // uint32_t binding / register index
+	bindingDescriptorCounts: u32, // uint32_t descriptors in the range (0 if unbounded)
+	bindingTypes:            u32, // uint32_t SlangcBindingType
+	bindingCategories:       u32, // uint32_t SlangcParameterCategory
+	bindingEntryPoints:      u32, // int32_t entry point index
+	bindingStageMasks:       u32, // uint32_t stage bits (1 << SlangcStage)
+
+	// Descriptor sets
+	setIndices: u32, // uint32_t descriptor set numbers, ascending
+	setHashes:  u32, // uint64_t canonical layout hash (8-byte aligned)
+
+	// Push-constant ranges
+	pushConstantSizes:       u32, // uint32_t size in bytes
+	pushConstantEntryPoints: u32, // int32_t entry point index
+	pushConstantParameters:  u32, // uint32_t index into the parameter arrays
+	pushConstantStageMasks:  u32, // uint32_t stage bits (1 << SlangcStage)
+	pushConstantHashes:      u32, // uint64_t canonical range hash (8-byte aligned)
+
+	stringTable: u32,
+}
+
+// Outputs affected by changed source files
+Invalidation :: struct {
+	outputCount:       i32,
+	outputNames:       [^]cstring, // Outputs that must be rebuilt, as passed to slangc_recordDependencies
+	moduleCount:       i32,
+	moduleNames:       [^]cstring, // Modules those outputs were built from
+	entryPointCount:   i32,
+	entryPointNames:   [^]cstring, // Entry points those outputs contain, once per output
+	entryPointOutputs: [^]i32,     // Index into outputNames of the output each entry point is in
+}
+
+// Called on the hot-reload thread each time a watched entry point is compiled. The
+// callback owns the result's blobs; release them with slangc_releaseCompileJobResults.
+Hot_Reload_Callback :: proc "c" (watchId: i32, result: ^Compile_Job_Result, userData: rawptr)
+
+// Hot-reload service description
+Hot_Reload_Desc :: struct {
+	pool:                 ^Session_Pool, // Pool to take a global session from (NULL for a service-owned pool)
+	searchPaths:          [^]cstring,
+	searchPathCount:      i32,
+	matrixLayoutMode:     Matrix_Layout_Mode,
+	fileSystem:           ^File_System,  // Optional file system for source loading; its cache is cleared on each change
+	timingProfile:        ^Profile,      // Optional timing profile to record calls into (can be NULL)
+	debounceMilliseconds: u32,           // Quiet time after the last write before recompiling (0 for 20 ms)
+	callback:             Hot_Reload_Callback,
+	userData:             rawptr,
+}
+
+// Range of workgroups run by one call of a host compute kernel
+// (matches ComputeVaryingInput in slang-cpp-types.h)
+Compute_Varying_Input :: struct {
+	startGroupID: [3]u32,
+	endGroupID:   [3]u32, // Exclusive
+}
+
+// Host compute kernel exported under the entry point's name (matches ComputeFunc
+// in slang-cpp-types.h). The uniform pointers must match the kernel's layout.
+Compute_Func :: proc "c" (varyingInput: ^Compute_Varying_Input, uniformEntryPointParams: rawptr, uniformState: rawptr)
+
+// Compute grid to run on the CPU
+Dispatch_Desc :: struct {
+	function:                Compute_Func, // Kernel from slangc_findHostCallableFunction
+	groupCount:              [3]u32,       // Workgroups along each axis
+	uniformEntryPointParams: rawptr,       // Entry point uniform parameters (can be NULL)
+	uniformState:            rawptr,       // Global uniform state (can be NULL)
 }
 
 @(default_calling_convention="c", link_prefix="slangc_")
@@ -168,12 +553,17 @@ foreign lib {
 	createGlobalSession :: proc() -> ^Global_Session ---
 
 	/** Create a global session with custom settings.
+	*
+	* If desc->coreModuleSnapshotPath is set, the core module is loaded from that file
+	* instead of being rebuilt. A missing snapshot, or one written by a different Slang
+	* build (as reported by the build tag), is replaced with a freshly saved one.
 	* @param desc Description of the global session configuration
 	* @return Pointer to the created global session, or NULL on failure
 	*/
 	createGlobalSessionWithDesc :: proc(desc: ^Global_Session_Desc) -> ^Global_Session ---
 
 	/** Release a global session and free its resources.
+	* Global sessions acquired from a pool must be returned with slangc_returnGlobalSession instead.
 	* @param globalSession The global session to release
 	*/
 	releaseGlobalSession :: proc(globalSession: ^Global_Session) ---
@@ -185,6 +575,43 @@ foreign lib {
 	*/
 	findProfile :: proc(globalSession: ^Global_Session, name: cstring) -> Profile_Id ---
 
+	/** Create a pool of global sessions for compiling on several threads.
+	*
+	* A global session, and every session, module, entry point, component type and
+	* blob created from it, must only be used by one thread at a time. The pool hands
+	* each global session to one thread at a time, so threads that only use objects
+	* created from the global session they currently hold never share Slang state.
+	* Global sessions are created lazily on first demand and reused afterwards.
+	* @param desc Pool description (can be NULL for defaults)
+	* @return Pointer to the created pool, or NULL on failure
+	*/
+	createSessionPool :: proc(desc: ^Session_Pool_Desc) -> ^Session_Pool ---
+
+	/** Release a session pool and every global session it owns.
+	* All acquired global sessions must have been returned first.
+	* @param pool The pool to release
+	*/
+	releaseSessionPool :: proc(pool: ^Session_Pool) ---
+
+	/** Acquire a global session for exclusive use by the calling thread.
+	*
+	* Reuses an idle global session (preferring the one this thread held last),
+	* creates a new one if the pool is below its limit, or blocks until another
+	* thread returns one. Do not pass the result to slangc_releaseGlobalSession.
+	* @param pool The session pool
+	* @return Pointer to the acquired global session, or NULL on failure
+	*/
+	acquireGlobalSession :: proc(pool: ^Session_Pool) -> ^Global_Session ---
+
+	/** Return an acquired global session to its pool.
+	* Objects created from it may only be used again after it has been re-acquired.
+	* @param pool The session pool
+	* @param globalSession The global session to return
+	* @return SLANGC_OK on success, or SLANGC_E_INVALID_ARG if the session is not from this pool
+	*         or is not checked out (e.g. returned twice)
+	*/
+	returnGlobalSession :: proc(pool: ^Session_Pool, globalSession: ^Global_Session) -> Result ---
+
 	/** Create a compilation session.
 	* @param globalSession The global session
 	* @param desc Session description (can be NULL for defaults)
@@ -200,11 +627,161 @@ foreign lib {
 	*/
 	createSessionWithProfile :: proc(globalSession: ^Global_Session, profile: Profile_Id, desc: ^Session_Desc) -> ^Session ---
 
+	/** Find a session with identical settings, or create one.
+	*
+	* Sessions are shared per global session. Two descriptions match when their targets,
+	* search paths, matrix layout, cache and macro sets are equal; macro sets are compared
+	* by name and value regardless of order. Each call must be paired with
+	* slangc_releaseSession, and the session is destroyed by the last release. Sessions
+	* still alive when their global session is released stop being shared but stay valid.
+	* @param globalSession The global session
+	* @param desc Session description (can be NULL for defaults)
+	* @return Pointer to the shared session, or NULL on failure
+	*/
+	findOrCreateSession :: proc(globalSession: ^Global_Session, desc: ^Session_Desc) -> ^Session ---
+
+	/** Get the fingerprint of a session's macro set.
+	* Sessions created with the same macros, in any order, have the same fingerprint.
+	* @param session The session
+	* @return 64-bit hash of the canonical macro set, or 0 if session is NULL
+	*/
+	getSessionMacroFingerprint :: proc(session: ^Session) -> u64 ---
+
 	/** Release a session and free its resources.
 	* @param session The session to release
 	*/
 	releaseSession :: proc(session: ^Session) ---
 
+	/** Create a persistent on-disk cache for compiled entry point code.
+	*
+	* Entries are keyed by the entry point hash reported by Slang, which covers the
+	* program's dependencies and the target options. Attach the cache to a session
+	* through SlangcSessionDesc::cache; slangc_getEntryPointCode will then consult it
+	* before running code generation. The cache may be shared by several sessions and
+	* must outlive every session it is attached to.
+	*
+	* With cacheModules set, slangc_loadModule also keeps each checked module, and the
+	* modules it imports, as a serialized binary module. A later load in any session
+	* with the same settings (targets, profile, search paths, macros and file system)
+	* validates the entry with ISession::isBinaryModuleUpToDate and loads it instead of
+	* parsing and checking the source again; stale entries fall
+	* back to the source and are replaced. Modules loaded from source text are not kept.
+	* @param desc Cache description
+	* @return Pointer to the created cache, or NULL on failure
+	*/
+	createCache :: proc(desc: ^Cache_Desc) -> ^Cache ---
+
+	/** Release a cache. Entries already written stay on disk.
+	* @param cache The cache to release
+	*/
+	releaseCache :: proc(cache: ^Cache) ---
+
+	/** Get the statistics of a cache.
+	* @param cache The cache to query
+	* @param outStats Pointer to receive the statistics
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	getCacheStats :: proc(cache: ^Cache, outStats: ^Cache_Stats) -> Result ---
+
+	/** Create a file system for loading module sources.
+	*
+	* The results of file loads and path lookups are cached by path, so a module
+	* imported by many others is only read once. When an archive is given, files
+	* stored in it are served from a single memory mapping of the archive before
+	* falling back to the OS; the archive must not be modified while the file system
+	* is alive. Files from the OS are copied, so editing them in place is safe.
+	* Attach the file system to a session through SlangcSessionDesc::fileSystem; it
+	* may be shared by several sessions and released while they are still alive.
+	* @param desc File system description (can be NULL for defaults)
+	* @return Pointer to the created file system, or NULL on failure
+	*/
+	createFileSystem :: proc(desc: ^File_System_Desc) -> ^File_System ---
+
+	/** Release a file system.
+	* @param fileSystem The file system to release
+	*/
+	releaseFileSystem :: proc(fileSystem: ^File_System) ---
+
+	/** Drop every cached file and path lookup, so later loads see changes on disk.
+	* Sources already loaded by a session are not affected.
+	* @param fileSystem The file system to clear
+	*/
+	clearFileSystemCache :: proc(fileSystem: ^File_System) ---
+
+	/** Pack files into an archive for SlangcFileSystemDesc::archivePath.
+	*
+	* Each file is stored under its normalized path as given, so pass the paths the
+	* way Slang will request them: a search path joined with the imported file name.
+	* @param archivePath Path of the archive to write
+	* @param filePaths Paths of the files to pack
+	* @param fileCount Number of files
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	writeFileSystemArchive :: proc(archivePath: cstring, filePaths: [^]cstring, fileCount: i32) -> Result ---
+
+	/** Create a timing profile.
+	*
+	* Attach the profile to a session through SlangcSessionDesc::timingProfile to record
+	* the wall and CPU time of every module load, entry point lookup, composite creation,
+	* link and code generation made through that session. Sessions with a profile also
+	* enable Slang's downstream time and performance benchmark reports; these are taken
+	* out of the diagnostics and recorded in the profile instead. A profile may be shared
+	* by several sessions and threads, and must outlive every session it is attached to.
+	* @return Pointer to the created profile, or NULL on failure
+	*/
+	createProfile :: proc() -> ^Profile ---
+
+	/** Release a timing profile.
+	* @param profile The profile to release
+	*/
+	releaseProfile :: proc(profile: ^Profile) ---
+
+	/** Clear every recorded time and benchmark entry.
+	* @param profile The profile to reset
+	*/
+	resetProfile :: proc(profile: ^Profile) ---
+
+	/** Get the accumulated timing of one phase.
+	* @param profile The profile to query
+	* @param phase The phase to query
+	* @param outStats Pointer to receive the statistics
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	getProfilePhaseStats :: proc(profile: ^Profile, phase: Profile_Phase, outStats: ^Profile_Phase_Stats) -> Result ---
+
+	/** Get the number of entries captured from Slang's performance benchmark reports.
+	* @param profile The profile to query
+	* @return Number of entries, or 0 if the profile is invalid
+	*/
+	getProfileBenchmarkEntryCount :: proc(profile: ^Profile) -> i32 ---
+
+	/** Get an entry captured from Slang's performance benchmark reports. Entries with the
+	* same name are accumulated over every report.
+	* @param profile The profile to query
+	* @param index Entry index, from 0 to slangc_getProfileBenchmarkEntryCount - 1
+	* @param outEntry Pointer to receive the entry
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	getProfileBenchmarkEntry :: proc(profile: ^Profile, index: i32, outEntry: ^Profile_Benchmark_Entry) -> Result ---
+
+	/** Start recording compile activity on every thread.
+	*
+	* While a trace runs, each module load, entry point lookup, composite creation, link
+	* and code generation is recorded with its module name, entry point name, target and
+	* thread. Events go to a fixed-size buffer per thread; when a buffer is full its oldest
+	* events are overwritten. Tracing costs a single flag check per call when not running.
+	* @param eventsPerThread Events kept per thread (0 for 65536)
+	* @return SLANGC_OK on success, or SLANGC_FAIL if a trace is already running
+	*/
+	beginTrace :: proc(eventsPerThread: u32) -> Result ---
+
+	/** Stop recording and write the trace as Chrome trace-event JSON, which can be
+	* opened in chrome://tracing or Perfetto.
+	* @param outputPath Path of the JSON file to write (can be NULL to discard the trace)
+	* @return SLANGC_OK on success, or SLANGC_FAIL if no trace is running or writing failed
+	*/
+	endTrace :: proc(outputPath: cstring) -> Result ---
+
 	/** Load a module by name (for import statements).
 	* @param session The compilation session
 	* @param moduleName The name of the module to load
@@ -214,6 +791,10 @@ foreign lib {
 	loadModule :: proc(session: ^Session, moduleName: cstring, outDiagnostics: ^^Blob) -> ^Module ---
 
 	/** Load a module from source code.
+	*
+	* The source text is not copied. Slang keeps referring to it for diagnostics, so the
+	* buffer must stay valid until the session is released. Use
+	* slangc_loadModuleFromSourceBuffer to hand the buffer over instead.
 	* @param session The compilation session
 	* @param moduleName The name to give the module
 	* @param path The file path (for error reporting)
@@ -224,6 +805,21 @@ foreign lib {
 	*/
 	loadModuleFromSource :: proc(session: ^Session, moduleName: cstring, path: cstring, sourceText: cstring, sourceSize: c.size_t, outDiagnostics: ^^Blob) -> ^Module ---
 
+	/** Load a module from an in-memory source buffer without copying it.
+	* @param session The compilation session
+	* @param moduleName The name to give the module
+	* @param path The file path (for error reporting)
+	* @param sourceText The source code text
+	* @param sourceSize The size of the source code (or 0 if null-terminated)
+	* @param takeOwnership If true, sourceText must have been allocated with malloc and is
+	*                      freed with free once Slang no longer needs it, whether or not the
+	*                      call succeeds. If false, the buffer must stay valid until the
+	*                      session is released.
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return Pointer to the loaded module, or NULL on failure
+	*/
+	loadModuleFromSourceBuffer :: proc(session: ^Session, moduleName: cstring, path: cstring, sourceText: cstring, sourceSize: c.size_t, takeOwnership: bool, outDiagnostics: ^^Blob) -> ^Module ---
+
 	/** Release a module.
 	* @param module The module to release
 	*/
@@ -247,6 +843,12 @@ foreign lib {
 	*/
 	getComponentTypeEntryPoint :: proc(componentType: ^Component_Type) -> ^Entry_Point ---
 
+	/** Get the underlying type conformance from a type conformance component type.
+	* @param componentType The component type (must be SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE)
+	* @return Pointer to the type conformance, or NULL if not a type conformance component type
+	*/
+	getComponentTypeTypeConformance :: proc(componentType: ^Component_Type) -> ^Type_Conformance ---
+
 	/** Create a composite component type from multiple components.
 	* @param session The compilation session
 	* @param componentTypes Array of component type structs to combine
@@ -270,6 +872,24 @@ foreign lib {
 	*/
 	releaseEntryPoint :: proc(entryPoint: ^Entry_Point) ---
 
+	/** Declare that a type conforms to an interface, for linking dynamic dispatch code.
+	*
+	* Adding type conformances to a composite limits the dynamic dispatch code for an
+	* interface to the listed types instead of every conforming type in scope.
+	* @param module Module in which to look up the type names
+	* @param typeName The conforming type, e.g. "Wood" or "Layered<Wood, Metal>"
+	* @param interfaceName The interface type
+	* @param conformanceId Dispatch ID for the type, or -1 to let Slang assign one
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return Pointer to the type conformance, or NULL on failure
+	*/
+	createTypeConformance :: proc(module: ^Module, typeName: cstring, interfaceName: cstring, conformanceId: i32, outDiagnostics: ^^Blob) -> ^Type_Conformance ---
+
+	/** Release a type conformance.
+	* @param typeConformance The type conformance to release
+	*/
+	releaseTypeConformance :: proc(typeConformance: ^Type_Conformance) ---
+
 	/** Create a component type from a module.
 	* @param module The module to wrap as a component type
 	* @return Pointer to the component type, or NULL on failure
@@ -282,6 +902,12 @@ foreign lib {
 	*/
 	createEntryPointComponentType :: proc(entryPoint: ^Entry_Point) -> ^Component_Type ---
 
+	/** Create a component type from a type conformance.
+	* @param typeConformance The type conformance to wrap as a component type
+	* @return Pointer to the component type, or NULL on failure
+	*/
+	createTypeConformanceComponentType :: proc(typeConformance: ^Type_Conformance) -> ^Component_Type ---
+
 	/** Link a component type to produce a linked program.
 	* @param componentType The component type to link
 	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
@@ -289,7 +915,26 @@ foreign lib {
 	*/
 	linkComponentType :: proc(componentType: ^Component_Type, outDiagnostics: ^^Blob) -> ^Component_Type ---
 
+	/** Specialize the generic and interface-typed parameters of a component type.
+	*
+	* Each argument is a type name as written in Slang. Generic applications such as
+	* "LayeredMaterial<Wood, Metal>" are resolved with their arguments specialized in
+	* turn. The result is cached in the owning session by component and arguments, so
+	* repeating a specialization reuses the earlier component type and produces no
+	* diagnostics; the cache lives until the session is released.
+	* @param componentType The component type to specialize (a module, entry point or composite)
+	* @param typeArgumentNames Type names, one per specialization parameter in order
+	* @param typeArgumentCount Number of type names
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return Pointer to the specialized component type, or NULL on failure
+	*/
+	specialize :: proc(componentType: ^Component_Type, typeArgumentNames: [^]cstring, typeArgumentCount: i32, outDiagnostics: ^^Blob) -> ^Component_Type ---
+
 	/** Get entry point code for a specific entry point and target.
+	*
+	* If the owning session has a cache attached, the cache is searched before
+	* running code generation and the result is stored in it afterwards. No
+	* diagnostics are produced for a cache hit.
 	* @param componentType The component type to compile (must be fully linked)
 	* @param entryPointIndex The entry point index (0-based). For simple cases with one entry point, use 0.
 	*                        For composite types, this corresponds to the order entry points were added.
@@ -299,11 +944,405 @@ foreign lib {
 	*/
 	getEntryPointCode :: proc(componentType: ^Component_Type, entryPointIndex: i32, targetIndex: i32, outDiagnostics: ^^Blob) -> ^Blob ---
 
+	/** Get the code for every entry point of a program on one target.
+	*
+	* One code generation pass emits a single module containing all entry points, e.g.
+	* one SPIR-V module for a vertex and fragment pair, instead of one pass per entry
+	* point. The session must have been created with generateWholeProgram set, and the
+	* target must support several entry points per module (SPIR-V, DXIL, Metal, etc.).
+	* The compiled-code cache is not consulted.
+	* @param componentType The component type to compile (must be fully linked)
+	* @param targetIndex The target index (0-based, from session targets)
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return Pointer to the compiled code blob, or NULL on failure
+	*/
+	getTargetCode :: proc(componentType: ^Component_Type, targetIndex: i32, outDiagnostics: ^^Blob) -> ^Blob ---
+
 	/** Release a component type.
 	* @param componentType The component type to release
 	*/
 	releaseComponentType :: proc(componentType: ^Component_Type) ---
 
+	/** Capture the layout of a program as a flat reflection snapshot.
+	*
+	* The layout is walked once and written to a single buffer that starts with a
+	* SlangcReflectionSnapshot header. The buffer holds no pointers, so it can be
+	* copied with memcpy or stored next to the compiled code and read back later.
+	* @param componentType The component type to reflect (usually a linked program)
+	* @param targetIndex The target index (0-based, from session targets)
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return Blob holding the snapshot, or NULL on failure
+	*/
+	buildReflectionSnapshot :: proc(componentType: ^Component_Type, targetIndex: i32, outDiagnostics: ^^Blob) -> ^Blob ---
+
+	/** Validate a snapshot loaded from memory or disk.
+	* @param data Snapshot bytes
+	* @param size Size of the data in bytes
+	* @return Pointer to the snapshot header, or NULL if the data is not a valid snapshot
+	*/
+	getReflectionSnapshot :: proc(data: rawptr, size: c.size_t) -> ^Reflection_Snapshot ---
+
+	/** Group programs that can share a pipeline layout.
+	*
+	* Programs are grouped by their descriptor set and push-constant range hashes, so
+	* a pipeline layout can be created once per group.
+	* @param snapshots Array of reflection snapshots, one per linked program, each checked
+	*                  like slangc_getReflectionSnapshot against its own totalSize
+	* @param snapshotCount Number of snapshots
+	* @param outGroupIndices Array of snapshotCount entries receiving each program's
+	*                        group index. Groups are numbered in first-seen order.
+	* @return Number of distinct layouts, or -1 on failure
+	*/
+	groupProgramsByLayout :: proc(snapshots: [^]^Reflection_Snapshot, snapshotCount: i32, outGroupIndices: [^]i32) -> i32 ---
+
+	/** Find which descriptor ranges compiled code actually uses.
+	*
+	* Bit i of the result is set if binding range i of the snapshot is used, so
+	* updates to unused ranges can be skipped. Slang generates the code to answer
+	* this, so compute it once per program and keep it with the snapshot.
+	* @param componentType The component type to query (must be fully linked)
+	* @param entryPointIndex The entry point index, or -1 for all entry points of the target
+	* @param targetIndex The target index (0-based, from session targets)
+	* @param snapshot Reflection snapshot built from the same component type and target,
+	*                 checked like slangc_getReflectionSnapshot against its own totalSize
+	* @param outBits Array of (snapshot->bindingCount + 31) / 32 words receiving the bits
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	getUsedBindings :: proc(componentType: ^Component_Type, entryPointIndex: i32, targetIndex: i32, snapshot: ^Reflection_Snapshot, outBits: [^]u32, outDiagnostics: ^^Blob) -> Result ---
+
+	/** Compile many entry points in parallel.
+	*
+	* Jobs run on an internal work-stealing thread pool. Jobs that share a module and
+	* macro set are scheduled together, so each worker parses and checks a module once
+	* and reuses it for every entry point. Each worker holds one global session from
+	* the pool while it runs a group of jobs.
+	* @param desc Batch description
+	* @param jobs Array of jobs to compile
+	* @param jobCount Number of jobs
+	* @param outResults Array of jobCount results, filled in job order. Release the
+	*                   blobs with slangc_releaseCompileJobResults.
+	* @return SLANGC_OK if every job succeeded, or an error code if any job failed
+	*/
+	compileBatch :: proc(desc: ^Batch_Desc, jobs: [^]Compile_Job, jobCount: i32, outResults: [^]Compile_Job_Result) -> Result ---
+
+	/** Release the blobs held by an array of batch results.
+	* @param results The results to release
+	* @param resultCount Number of results
+	*/
+	releaseCompileJobResults :: proc(results: [^]Compile_Job_Result, resultCount: i32) ---
+
+	/** Compile every variant of an entry point across a set of macro dimensions.
+	*
+	* Variants are enumerated with the first dimension varying slowest, passed through
+	* the optional filter, and compiled in parallel with slangc_compileBatch. Outputs
+	* with identical bytes are stored once, so variants that compile to the same code
+	* share a blob index.
+	* @param desc Permutation description
+	* @param batchDesc Batch settings used to compile the variants
+	* @param outResults Filled with the variant table and unique outputs. Release with
+	*                   slangc_releasePermutationResults, even on failure.
+	* @return SLANGC_OK if every variant compiled, or an error code if any failed
+	*/
+	compilePermutations :: proc(desc: ^Permutation_Desc, batchDesc: ^Batch_Desc, outResults: ^Permutation_Results) -> Result ---
+
+	/** Release the tables and blobs held by permutation results.
+	* @param results The results to release
+	*/
+	releasePermutationResults :: proc(results: ^Permutation_Results) ---
+
+	/** Create a background executor for asynchronous compiles.
+	*
+	* The executor owns its threads and keeps the sessions and checked modules it
+	* creates warm between compiles. Before reusing a session it compares the size and
+	* modification time of every file its modules were loaded from, and loads them
+	* again if any changed. Higher priority tickets start first; tickets with
+	* equal priority start in submission order.
+	* @param desc Executor description (can be NULL for defaults)
+	* @return Pointer to the created executor, or NULL on failure
+	*/
+	createCompileExecutor :: proc(desc: ^Compile_Executor_Desc) -> ^Compile_Executor ---
+
+	/** Release an executor. Compiles already running are finished, pending tickets are
+	* cancelled, and every callback has run by the time this returns.
+	* @param executor The executor to release
+	*/
+	releaseCompileExecutor :: proc(executor: ^Compile_Executor) ---
+
+	/** Queue a compile on the executor without blocking.
+	* @param executor The executor
+	* @param job The job to compile (copied, so it need not outlive the call)
+	* @param priority Scheduling priority, higher values start first
+	* @param callback Completion callback, run on an executor thread (can be NULL)
+	* @param userData Value passed to the callback
+	* @return Ticket for the compile, or NULL on failure. Release with slangc_releaseCompileTicket.
+	*/
+	compileAsync :: proc(executor: ^Compile_Executor, job: ^Compile_Job, priority: i32, callback: Compile_Callback, userData: rawptr) -> ^Compile_Ticket ---
+
+	/** Get the current state of a ticket without blocking.
+	* @param ticket The ticket
+	* @return The ticket status
+	*/
+	pollCompileTicket :: proc(ticket: ^Compile_Ticket) -> Compile_Ticket_Status ---
+
+	/** Wait for a ticket to finish.
+	* @param ticket The ticket
+	* @param timeoutMilliseconds Maximum time to wait, or SLANGC_WAIT_INFINITE
+	* @return The ticket status when the wait ended
+	*/
+	waitCompileTicket :: proc(ticket: ^Compile_Ticket, timeoutMilliseconds: u32) -> Compile_Ticket_Status ---
+
+	/** Cancel a ticket that has not started yet.
+	* @param ticket The ticket
+	* @return true if the ticket was cancelled, false if it had already started
+	*/
+	cancelCompileTicket :: proc(ticket: ^Compile_Ticket) -> bool ---
+
+	/** Change the priority of a ticket that has not started yet.
+	* @param ticket The ticket
+	* @param priority New scheduling priority, higher values start first
+	* @return SLANGC_OK on success, or SLANGC_FAIL if the ticket has already started
+	*/
+	setCompileTicketPriority :: proc(ticket: ^Compile_Ticket, priority: i32) -> Result ---
+
+	/** Take the result of a finished ticket. Ownership of the blobs moves to the caller;
+	* later calls return NULL blobs.
+	* @param ticket The ticket
+	* @param outResult Pointer to receive the result
+	* @return SLANGC_OK on success, or SLANGC_FAIL if the ticket has not finished
+	*/
+	takeCompileTicketResult :: proc(ticket: ^Compile_Ticket, outResult: ^Compile_Job_Result) -> Result ---
+
+	/** Get how long a finished ticket waited in the queue and how long it ran. The run
+	* time covers everything the executor thread did for the ticket: taking a global
+	* session, loading the module and generating code.
+	* @param ticket The ticket
+	* @param outQueuedMilliseconds Receives the time from submission to start (can be NULL)
+	* @param outRunMilliseconds Receives the time from start to finish (can be NULL)
+	* @return SLANGC_OK on success, or SLANGC_FAIL if the ticket has not finished or was cancelled
+	*/
+	getCompileTicketTiming :: proc(ticket: ^Compile_Ticket, outQueuedMilliseconds: ^f64, outRunMilliseconds: ^f64) -> Result ---
+
+	/** Release a ticket. The compile itself is not cancelled; use slangc_cancelCompileTicket for that.
+	* @param ticket The ticket to release
+	*/
+	releaseCompileTicket :: proc(ticket: ^Compile_Ticket) ---
+
+	/** Create a compile server listening on a Unix domain socket.
+	*
+	* The server keeps global sessions, sessions and checked modules warm across
+	* requests, so clients calling slangc_compileBatchRemote skip Slang startup. Requests
+	* are served by slangc_runCompileServer. Not available on Windows.
+	*
+	* The socket's directory must belong to the current user and be writable only by
+	* them; a missing directory is created with mode 0700. The socket is created with
+	* mode 0600, and connections from other users are closed unanswered.
+	* @param desc Server description (can be NULL for defaults)
+	* @return Pointer to the created server, or NULL on failure (including when another
+	*         server already listens on the socket)
+	*/
+	createCompileServer :: proc(desc: ^Compile_Server_Desc) -> ^Compile_Server ---
+
+	/** Accept and serve connections until slangc_stopCompileServer is called.
+	* @param server The server
+	* @return SLANGC_OK once stopped, or an error code on failure
+	*/
+	runCompileServer :: proc(server: ^Compile_Server) -> Result ---
+
+	/** Ask a running server to stop. Safe to call from a signal handler.
+	* @param server The server
+	*/
+	stopCompileServer :: proc(server: ^Compile_Server) ---
+
+	/** Release a server and remove its socket file. The server must not be running.
+	* @param server The server to release
+	*/
+	releaseCompileServer :: proc(server: ^Compile_Server) ---
+
+	/** Get the statistics of a compile server. Safe to call while it is running.
+	* @param server The server to query
+	* @param outStats Pointer to receive the statistics
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	getCompileServerStats :: proc(server: ^Compile_Server, outStats: ^Compile_Server_Stats) -> Result ---
+
+	/** Compile a batch on a running compile server, or in process when none answers.
+	*
+	* Results match slangc_compileBatch. Search paths, depfile paths, and module names
+	* that are file paths (containing a directory or ending in .slang) and exist relative
+	* to the working directory are made absolute before forwarding; output paths are
+	* sent as written, since they only name the depfile target. Depfiles are written by
+	* the server. A server that sends nothing for 30 seconds is abandoned and the batch
+	* is compiled in process. Batches with a file system or timing profile attached are
+	* always compiled in process, and the pool and cache of the description only apply
+	* then.
+	* @param socketPath Server socket (NULL for SLANGC_SERVER_SOCKET, then
+	*                   $XDG_RUNTIME_DIR/slangc-server.sock, then /tmp/slangc-UID/server.sock).
+	*                   A socket not owned by the current user, in a directory others
+	*                   can write to, or served by another user is not used.
+	* @param desc Batch settings
+	* @param jobs Jobs to compile
+	* @param jobCount Number of jobs
+	* @param outResults Array of jobCount results to fill. Release with slangc_releaseCompileJobResults.
+	* @return SLANGC_OK if every job succeeded, or an error code if any failed
+	*/
+	compileBatchRemote :: proc(socketPath: cstring, desc: ^Batch_Desc, jobs: [^]Compile_Job, jobCount: i32, outResults: [^]Compile_Job_Result) -> Result ---
+
+	/** Get the number of source files a module was built from, including its imports.
+	* @param module The loaded module
+	* @return Number of dependency files, or -1 on failure
+	*/
+	getModuleDependencyFileCount :: proc(module: ^Module) -> i32 ---
+
+	/** Get the path of one of a module's dependency files.
+	* @param module The loaded module
+	* @param index The dependency index (0-based)
+	* @return The file path (valid while the module is loaded), or NULL on failure
+	*/
+	getModuleDependencyFilePath :: proc(module: ^Module, index: i32) -> cstring ---
+
+	/** Write a Makefile-syntax depfile for a compiled component type.
+	*
+	* The depfile holds one rule whose prerequisites are the dependency files of every
+	* module behind the component type, in the form Make and Ninja (deps = gcc) read.
+	* Batch jobs write one themselves when SlangcCompileJob::depfilePath is set.
+	* @param componentType The component type the output was compiled from
+	* @param targetPath The output file named as the rule target
+	* @param depfilePath The depfile to write (replaced once complete)
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	writeDepfile :: proc(componentType: ^Component_Type, targetPath: cstring, depfilePath: cstring) -> Result ---
+
+	/** Create a graph mapping source files to the outputs built from them.
+	* @param path File the graph is loaded from if it exists, and saved to by
+	*             slangc_saveDependencyGraph (can be NULL for an in-memory graph)
+	* @return Pointer to the created graph, or NULL on failure
+	*/
+	createDependencyGraph :: proc(path: cstring) -> ^Dependency_Graph ---
+
+	/** Release a dependency graph without saving it.
+	* @param graph The graph to release
+	*/
+	releaseDependencyGraph :: proc(graph: ^Dependency_Graph) ---
+
+	/** Write a dependency graph to the path it was created with.
+	* @param graph The graph to save
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	saveDependencyGraph :: proc(graph: ^Dependency_Graph) -> Result ---
+
+	/** Record the modules, entry points and source files an output was built from.
+	*
+	* Any earlier record for the same output is replaced.
+	* @param graph The graph to update
+	* @param outputName Caller-chosen name for the output, e.g. the path its code is written to
+	* @param componentType The component type the output was compiled from
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	recordDependencies :: proc(graph: ^Dependency_Graph, outputName: cstring, componentType: ^Component_Type) -> Result ---
+
+	/** Find the outputs that depend on any of a set of changed files.
+	* @param graph The graph to query
+	* @param paths Changed source file paths
+	* @param pathCount Number of paths
+	* @param outInvalidation Filled with the affected outputs, modules and entry points.
+	*                        Release with slangc_releaseInvalidation.
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	invalidate :: proc(graph: ^Dependency_Graph, paths: [^]cstring, pathCount: i32, outInvalidation: ^Invalidation) -> Result ---
+
+	/** Release the names held by an invalidation result.
+	* @param invalidation The result to release
+	*/
+	releaseInvalidation :: proc(invalidation: ^Invalidation) ---
+
+	/** Create a service that recompiles entry points when their source files change.
+	*
+	* The service watches the directories of every file the watched entry points were
+	* built from (Linux inotify) and recompiles on a background thread once writes have
+	* been quiet for the debounce time. Only entry points that depend on a changed file
+	* are recompiled, and modules whose files did not change are reused from their
+	* checked form instead of being parsed again.
+	* An entry point whose module has never loaded is retried on any change in the
+	* working directory or search paths, and every entry point is recompiled if the
+	* kernel drops watch events.
+	* @param desc Service description (the callback is required)
+	* @return Pointer to the created service, or NULL on failure or on platforms
+	*         without inotify
+	*/
+	createHotReload :: proc(desc: ^Hot_Reload_Desc) -> ^Hot_Reload ---
+
+	/** Stop watching and release a hot-reload service. A compile already running is
+	* finished and its callbacks have run by the time this returns.
+	* @param hotReload The service to release
+	*/
+	releaseHotReload :: proc(hotReload: ^Hot_Reload) ---
+
+	/** Start watching an entry point. It is compiled once right away, and again each
+	* time one of its files changes; every compile is delivered to the callback.
+	* @param hotReload The service
+	* @param job The entry point to compile (copied)
+	* @return Watch ID passed to the callback, or -1 on failure
+	*/
+	watchEntryPoint :: proc(hotReload: ^Hot_Reload, job: ^Compile_Job) -> i32 ---
+
+	/** Stop watching an entry point. The service thread drops it along with the
+	* directory watches and kept modules nothing else needs; a compile already running
+	* may still report it once. Unwatching the same ID twice is harmless.
+	* @param hotReload The service
+	* @param watchId Watch ID returned by slangc_watchEntryPoint
+	* @return SLANGC_OK on success, or an error code if the ID was never returned
+	*/
+	unwatchEntryPoint :: proc(hotReload: ^Hot_Reload, watchId: i32) -> Result ---
+
+	/** Compile an entry point for the host CPU and load it as a shared library.
+	*
+	* The session must have a SLANGC_TARGET_HOST_CALLABLE or
+	* SLANGC_TARGET_SHADER_HOST_CALLABLE target. Compute entry points are exported
+	* under their own name with the SlangcComputeFunc signature.
+	* @param componentType The component type to compile (must be fully linked)
+	* @param entryPointIndex The entry point index (0-based)
+	* @param targetIndex The target index (0-based, from session targets)
+	* @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+	* @return Pointer to the loaded code, or NULL on failure
+	*/
+	getEntryPointHostCallable :: proc(componentType: ^Component_Type, entryPointIndex: i32, targetIndex: i32, outDiagnostics: ^^Blob) -> ^Host_Callable ---
+
+	/** Look up an exported function in host-callable code.
+	* @param hostCallable The loaded code
+	* @param name The symbol name, e.g. the entry point name
+	* @return Function pointer, or NULL if the symbol was not found. Valid until the
+	*         host callable is released.
+	*/
+	findHostCallableFunction :: proc(hostCallable: ^Host_Callable, name: cstring) -> rawptr ---
+
+	/** Unload host-callable code.
+	* @param hostCallable The code to release
+	*/
+	releaseHostCallable :: proc(hostCallable: ^Host_Callable) ---
+
+	/** Create a thread pool for running host compute kernels.
+	* @param threadCount Worker threads (0 for one per hardware thread)
+	* @return Pointer to the created dispatcher, or NULL on failure
+	*/
+	createComputeDispatcher :: proc(threadCount: i32) -> ^Compute_Dispatcher ---
+
+	/** Release a dispatcher. Must not be called while a dispatch is running.
+	* @param dispatcher The dispatcher to release
+	*/
+	releaseComputeDispatcher :: proc(dispatcher: ^Compute_Dispatcher) ---
+
+	/** Run a compute kernel over a 3D grid of workgroups and wait for it to finish.
+	*
+	* The grid is split into boxes of whole workgroups that the dispatcher's workers
+	* run in parallel, stealing boxes from each other to stay busy. The kernel must
+	* not depend on the order workgroups run in.
+	* @param dispatcher The dispatcher to run on
+	* @param desc Kernel, grid size and uniform data
+	* @return SLANGC_OK on success, or an error code on failure
+	*/
+	dispatchCompute :: proc(dispatcher: ^Compute_Dispatcher, desc: ^Dispatch_Desc) -> Result ---
+
 	/** Get the data pointer from a blob.
 	* @param blob The blob
 	* @return Pointer to the blob data
@@ -1,9 +1,55 @@
 #include "slangc.h"
 #include "include/slang.h"
 #include "include/slang-com-ptr.h"
+#include "include/slang-com-helper.h"
 #include <string>
+#include <cstring>
+#include <cstdlib>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <list>
+#include <unordered_map>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <chrono>
+#include <unordered_set>
+#include <ctime>
+#include <cstdio>
+#include <sstream>
+#include <map>
+#include <array>
+#include <type_traits>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#endif
 
 using namespace slang;
 
@@ -12,7 +58,10 @@ static thread_local std::string g_lastError;
 static thread_local bool g_hasError = false;
 
 // Global state management
-static bool g_hasBeenShutdown = false;
+static std::atomic<bool> g_hasBeenShutdown{false};
+
+// Identifies a handle for its whole lifetime; unlike its address, never reused by a later handle
+static std::atomic<uint64_t> g_nextHandleId{1};
 
 // Helper to set error state
 void setError(const std::string &message)
@@ -37,27 +86,134 @@ bool isSlangAvailable()
 struct SlangcGlobalSession
 {
     Slang::ComPtr<IGlobalSession> session;
+    SlangcSessionPool *pool = nullptr; // Owning pool, if the session was created by one
+    std::thread::id lastOwner;         // Thread that last acquired the session from its pool
+    bool checkedOut = false;           // Guarded by the pool mutex
+    std::unordered_map<std::string, SlangcSession *> sharedSessions; // Keyed by session settings
+
+    ~SlangcGlobalSession();
+};
+
+// Pool of lazily created global sessions, each checked out by at most one thread at a time
+struct SlangcSessionPool
+{
+    std::mutex mutex;
+    std::condition_variable sessionReturned;
+    int32_t maxGlobalSessions = 0;
+    int32_t createdCount = 0; // Includes sessions that are still being created
+    std::vector<std::unique_ptr<SlangcGlobalSession>> sessions;
+    std::vector<SlangcGlobalSession *> idle;
+
+    // Settings used to create each global session
+    SlangcGlobalSessionDesc globalSessionDesc = {};
+    std::vector<std::string> searchPaths;
+    std::vector<const char *> searchPathPointers;
+    std::string coreModuleSnapshotPath;
+};
+
+// On-disk compiled-code cache, shared between sessions
+struct SlangcCache
+{
+    struct Entry
+    {
+        uint64_t size;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    uint64_t handleId = g_nextHandleId++;
+    std::mutex mutex;
+    std::filesystem::path directory;
+    uint64_t maxSizeBytes = 0;
+    uint64_t totalSizeBytes = 0;
+    bool cacheModules = false;
+    std::list<std::string> lru; // Most recently used key at the front
+    std::unordered_map<std::string, Entry> entries;
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t moduleHitCount = 0;
+    uint64_t moduleMissCount = 0;
+    uint64_t evictionCount = 0;
+};
+
+// Timing of wrapper calls, shared between sessions and threads
+struct SlangcProfile
+{
+    struct BenchmarkEntry
+    {
+        std::string name;
+        uint64_t invocationCount = 0;
+        double milliseconds = 0.0;
+    };
+
+    uint64_t handleId = g_nextHandleId++;
+    std::mutex mutex;
+    SlangcProfilePhaseStats phases[SLANGC_PROFILE_PHASE_COUNT] = {};
+    std::deque<BenchmarkEntry> benchmarkEntries; // Deque so entry names stay put as it grows
+    std::unordered_map<std::string, size_t> benchmarkIndices;
 };
 
 struct SlangcSession
 {
     Slang::ComPtr<ISession> session;
+    SlangcCache *cache = nullptr;
+    SlangcProfile *profile = nullptr;
+    std::vector<SlangcCompileTarget> targets; // Target of each target index
+    std::string buildTag;
+    std::string moduleCacheScope; // Settings checked modules depend on; empty if modules are not cached
+    uint64_t macroFingerprint = 0; // Hash of the canonical macro set
+
+    // Results of slangc_specialize, keyed by component and type arguments. Each entry
+    // holds the unspecialized component so its address cannot be reused by another.
+    struct Specialization
+    {
+        Slang::ComPtr<IComponentType> base;
+        Slang::ComPtr<IComponentType> specialized;
+    };
+    std::mutex specializationMutex;
+    std::unordered_map<std::string, Specialization> specializations;
+
+    // Set for sessions shared through slangc_findOrCreateSession
+    SlangcGlobalSession *sharedOwner = nullptr;
+    std::string sharedKey;
+    uint32_t sharedRefCount = 0;
 };
 
+// Shared sessions may outlive their global session; they then become ordinary sessions
+SlangcGlobalSession::~SlangcGlobalSession()
+{
+    for (auto &shared : sharedSessions)
+        shared.second->sharedOwner = nullptr;
+}
+
 struct SlangcModule
 {
     Slang::ComPtr<IModule> module;
+    SlangcSession *session = nullptr;
 };
 
 struct SlangcEntryPoint
 {
     Slang::ComPtr<IEntryPoint> entryPoint;
+    Slang::ComPtr<IModule> module; // Module the entry point was found in
+    SlangcSession *session = nullptr;
+};
+
+struct SlangcTypeConformance
+{
+    Slang::ComPtr<ITypeConformance> conformance;
+    SlangcSession *session = nullptr;
 };
 
 // Internal composite wrapper for C++ ComPtr management
 struct SlangcComposite
 {
     Slang::ComPtr<IComponentType> composite;
+    SlangcSession *session = nullptr;
+    std::vector<Slang::ComPtr<IModule>> modules; // Every module the composite was built from
+
+    // Names of the components, recorded only while a trace is running
+    std::string traceModuleNames;
+    std::vector<std::string> traceEntryPointNames;
 };
 
 struct SlangcBlob
@@ -79,289 +235,2393 @@ IComponentType *getComponentType(const SlangcComponentType *componentType)
         return componentType->entryPoint ? componentType->entryPoint->entryPoint.get() : nullptr;
     case SLANGC_COMPONENT_TYPE_COMPOSITE:
         return componentType->composite ? static_cast<SlangcComposite *>(componentType->composite)->composite.get() : nullptr;
+    case SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE:
+        return componentType->typeConformance ? componentType->typeConformance->conformance.get() : nullptr;
     default:
         return nullptr;
     }
 }
 
-// Helper functions
-namespace
+// Helper function to get the session a SlangcComponentType was created from
+SlangcSession *getOwningSession(const SlangcComponentType *componentType)
 {
-    SlangcResult convertResult(SlangResult result)
+    if (!componentType)
+        return nullptr;
+
+    switch (componentType->kind)
     {
-        switch (result)
-        {
-        case SLANG_OK:
-            return SLANGC_OK;
-        case SLANG_FAIL:
-            return SLANGC_FAIL;
-        case SLANG_E_NOT_IMPLEMENTED:
-            return SLANGC_E_NOT_IMPLEMENTED;
-        case SLANG_E_INVALID_ARG:
-            return SLANGC_E_INVALID_ARG;
-        case SLANG_E_OUT_OF_MEMORY:
-            return SLANGC_E_OUT_OF_MEMORY;
-        case SLANG_E_BUFFER_TOO_SMALL:
-            return SLANGC_E_BUFFER_TOO_SMALL;
-        default:
-            return SLANGC_FAIL;
-        }
+    case SLANGC_COMPONENT_TYPE_MODULE:
+        return componentType->module ? componentType->module->session : nullptr;
+    case SLANGC_COMPONENT_TYPE_ENTRY_POINT:
+        return componentType->entryPoint ? componentType->entryPoint->session : nullptr;
+    case SLANGC_COMPONENT_TYPE_COMPOSITE:
+        return componentType->composite ? static_cast<SlangcComposite *>(componentType->composite)->session : nullptr;
+    case SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE:
+        return componentType->typeConformance ? componentType->typeConformance->session : nullptr;
+    default:
+        return nullptr;
     }
+}
 
-    SlangSourceLanguage convertSourceLanguage(SlangcSourceLanguage lang)
+// Appends the modules behind an array of component types, skipping duplicates
+void collectComponentModules(
+    const SlangcComponentType *componentTypes,
+    int32_t componentTypeCount,
+    std::vector<Slang::ComPtr<IModule>> &outModules)
+{
+    auto addModule = [&outModules](IModule *module)
     {
-        switch (lang)
-        {
-        case SLANGC_SOURCE_LANGUAGE_SLANG:
-            return SLANG_SOURCE_LANGUAGE_SLANG;
-        case SLANGC_SOURCE_LANGUAGE_HLSL:
-            return SLANG_SOURCE_LANGUAGE_HLSL;
-        case SLANGC_SOURCE_LANGUAGE_GLSL:
-            return SLANG_SOURCE_LANGUAGE_GLSL;
-        case SLANGC_SOURCE_LANGUAGE_C:
-            return SLANG_SOURCE_LANGUAGE_C;
-        case SLANGC_SOURCE_LANGUAGE_CPP:
-            return SLANG_SOURCE_LANGUAGE_CPP;
-        default:
-            return SLANG_SOURCE_LANGUAGE_UNKNOWN;
-        }
-    }
+        if (module && std::find(outModules.begin(), outModules.end(), module) == outModules.end())
+            outModules.push_back(Slang::ComPtr<IModule>(module));
+    };
 
-    SlangCompileTarget convertCompileTarget(SlangcCompileTarget target)
+    for (int32_t i = 0; i < componentTypeCount; i++)
     {
-        switch (target)
+        const SlangcComponentType &component = componentTypes[i];
+        switch (component.kind)
         {
-        case SLANGC_TARGET_HLSL:
-            return SLANG_HLSL;
-        case SLANGC_TARGET_GLSL:
-            return SLANG_GLSL;
-        case SLANGC_TARGET_SPIRV:
-            return SLANG_SPIRV;
-        case SLANGC_TARGET_SPIRV_ASM:
-            return SLANG_SPIRV_ASM;
-        case SLANGC_TARGET_DXBC:
-            return SLANG_DXBC;
-        case SLANGC_TARGET_DXBC_ASM:
-            return SLANG_DXBC_ASM;
-        case SLANGC_TARGET_DXIL:
-            return SLANG_DXIL;
-        case SLANGC_TARGET_DXIL_ASM:
-            return SLANG_DXIL_ASM;
-        case SLANGC_TARGET_C_SOURCE:
-            return SLANG_C_SOURCE;
-        case SLANGC_TARGET_CPP_SOURCE:
-            return SLANG_CPP_SOURCE;
-        case SLANGC_TARGET_CUDA_SOURCE:
-            return SLANG_CUDA_SOURCE;
-        case SLANGC_TARGET_PTX:
-            return SLANG_PTX;
-        case SLANGC_TARGET_CUBIN:
-            return SLANG_CUDA_OBJECT_CODE;
-        case SLANGC_TARGET_METAL:
-            return SLANG_METAL;
-        case SLANGC_TARGET_METAL_LIB:
-            return SLANG_METAL_LIB;
-        case SLANGC_TARGET_HOST_CALLABLE:
-            return SLANG_SHADER_HOST_CALLABLE;
-        case SLANGC_TARGET_SHADER_SHARED_LIBRARY:
-            return SLANG_SHADER_SHARED_LIBRARY;
-        case SLANGC_TARGET_SHADER_HOST_CALLABLE:
-            return SLANG_SHADER_HOST_CALLABLE;
-        case SLANGC_TARGET_WGSL:
-            return SLANG_WGSL;
-        default:
-            return SLANG_TARGET_UNKNOWN;
+        case SLANGC_COMPONENT_TYPE_MODULE:
+            if (component.module)
+                addModule(component.module->module);
+            break;
+        case SLANGC_COMPONENT_TYPE_ENTRY_POINT:
+            if (component.entryPoint)
+                addModule(component.entryPoint->module);
+            break;
+        case SLANGC_COMPONENT_TYPE_COMPOSITE:
+            if (component.composite)
+            {
+                for (const auto &module : static_cast<const SlangcComposite *>(component.composite)->modules)
+                    addModule(module);
+            }
+            break;
+        case SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE:
+            break;
         }
     }
+}
 
-    SlangStage convertStage(SlangcStage stage)
+// Blob implementation owning a copy of its data
+class OwnedBlob final : public ISlangBlob
+{
+public:
+    explicit OwnedBlob(std::vector<uint8_t> &&data)
+        : m_data(std::move(data)), m_size(m_data.size())
     {
-        switch (stage)
-        {
-        case SLANGC_STAGE_VERTEX:
-            return SLANG_STAGE_VERTEX;
-        case SLANGC_STAGE_HULL:
-            return SLANG_STAGE_HULL;
-        case SLANGC_STAGE_DOMAIN:
-            return SLANG_STAGE_DOMAIN;
-        case SLANGC_STAGE_GEOMETRY:
-            return SLANG_STAGE_GEOMETRY;
-        case SLANGC_STAGE_FRAGMENT:
-            return SLANG_STAGE_FRAGMENT;
-        case SLANGC_STAGE_COMPUTE:
-            return SLANG_STAGE_COMPUTE;
-        case SLANGC_STAGE_RAY_GENERATION:
-            return SLANG_STAGE_RAY_GENERATION;
-        case SLANGC_STAGE_INTERSECTION:
-            return SLANG_STAGE_INTERSECTION;
-        case SLANGC_STAGE_ANY_HIT:
-            return SLANG_STAGE_ANY_HIT;
-        case SLANGC_STAGE_CLOSEST_HIT:
-            return SLANG_STAGE_CLOSEST_HIT;
-        case SLANGC_STAGE_MISS:
-            return SLANG_STAGE_MISS;
-        case SLANGC_STAGE_CALLABLE:
-            return SLANG_STAGE_CALLABLE;
-        case SLANGC_STAGE_MESH:
-            return SLANG_STAGE_MESH;
-        case SLANGC_STAGE_AMPLIFICATION:
-            return SLANG_STAGE_AMPLIFICATION;
-        default:
-            return SLANG_STAGE_NONE;
-        }
     }
 
-    SlangMatrixLayoutMode convertMatrixLayoutMode(SlangcMatrixLayoutMode mode)
+    // Creates a blob holding text; the data is null-terminated but the size excludes the terminator
+    static OwnedBlob *createText(const std::string &text)
     {
-        switch (mode)
-        {
-        case SLANGC_MATRIX_LAYOUT_ROW_MAJOR:
-            return SLANG_MATRIX_LAYOUT_ROW_MAJOR;
-        case SLANGC_MATRIX_LAYOUT_COLUMN_MAJOR:
-            return SLANG_MATRIX_LAYOUT_COLUMN_MAJOR;
-        default:
-            return SLANG_MATRIX_LAYOUT_ROW_MAJOR;
-        }
+        std::vector<uint8_t> data(text.begin(), text.end());
+        data.push_back(0);
+        auto blob = new OwnedBlob(std::move(data));
+        blob->m_size = text.size();
+        return blob;
     }
 
-    // Helper to create a wrapper for diagnostics blob
-    void setDiagnosticsOutput(SlangcBlob **outDiagnostics, Slang::ComPtr<ISlangBlob> &diagnostics)
+    SLANG_NO_THROW SlangResult SLANG_MCALL queryInterface(SlangUUID const &uuid, void **outObject) override
     {
-        if (outDiagnostics && diagnostics)
+        if (uuid == ISlangUnknown::getTypeGuid() || uuid == ISlangBlob::getTypeGuid())
         {
-            auto diagWrapper = std::make_unique<SlangcBlob>();
-            diagWrapper->blob = diagnostics;
-            *outDiagnostics = diagWrapper.release();
+            addRef();
+            *outObject = static_cast<ISlangBlob *>(this);
+            return SLANG_OK;
         }
+        return SLANG_E_NO_INTERFACE;
     }
-}
-
-//
-// Global Session Management
-//
 
-SlangcGlobalSession *slangc_createGlobalSession(void)
-{
-    if (!isSlangAvailable())
+    SLANG_NO_THROW uint32_t SLANG_MCALL addRef() override
     {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
+        return ++m_refCount;
     }
-    clearError();
 
-    auto wrapper = std::make_unique<SlangcGlobalSession>();
-
-    SlangResult result = slang_createGlobalSession(SLANG_API_VERSION, wrapper->session.writeRef());
-    if (SLANG_FAILED(result))
+    SLANG_NO_THROW uint32_t SLANG_MCALL release() override
     {
-        setError("Failed to create global session");
-        return nullptr;
+        uint32_t count = --m_refCount;
+        if (count == 0)
+            delete this;
+        return count;
     }
 
-    return wrapper.release();
-}
-
-SlangcGlobalSession *slangc_createGlobalSessionWithDesc(
-    const SlangcGlobalSessionDesc *desc)
-{
-    if (!isSlangAvailable())
+    SLANG_NO_THROW void const *SLANG_MCALL getBufferPointer() override
     {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
+        return m_data.data();
     }
 
-    clearError();
-    if (!desc)
+    SLANG_NO_THROW size_t SLANG_MCALL getBufferSize() override
     {
-        setError("Invalid session description");
-        return nullptr;
+        return m_size;
     }
 
-    auto wrapper = std::make_unique<SlangcGlobalSession>();
+private:
+    std::vector<uint8_t> m_data;
+    size_t m_size;
+    std::atomic<uint32_t> m_refCount{0};
+};
 
-    // Fallback to basic global session creation since slang_createGlobalSession2 may not be available
-    SlangResult result = slang_createGlobalSession(desc->apiVersion, wrapper->session.writeRef());
-    if (SLANG_FAILED(result))
+// Blob over memory the wrapper does not allocate. Borrowed memory is never copied or
+// freed; owned memory was allocated with malloc and is freed with the blob.
+class ExternalBlob final : public ISlangBlob
+{
+public:
+    ExternalBlob(const void *data, size_t size, bool owned)
+        : m_data(data), m_size(size), m_owned(owned)
     {
-        setError("Failed to create global session with description");
-        return nullptr;
     }
 
-    return wrapper.release();
-}
-
-void slangc_releaseGlobalSession(SlangcGlobalSession *globalSession)
-{
-    delete globalSession;
-}
-
-SlangcProfileID slangc_findProfile(SlangcGlobalSession *globalSession, const char *name)
-{
-    if (!isSlangAvailable())
-        return 0;
-    if (!globalSession || !name)
-        return 0;
-    return globalSession->session->findProfile(name);
-}
-
-//
-// Session Management
-//
-
-SlangcSession *slangc_createSession(
-    SlangcGlobalSession *globalSession,
-    const SlangcSessionDesc *desc)
-{
-
-    if (!isSlangAvailable())
+    // Borrows memory owned by keepAlive, which is held until the blob is destroyed
+    ExternalBlob(const void *data, size_t size, std::shared_ptr<const void> keepAlive)
+        : m_data(data), m_size(size), m_owned(false), m_keepAlive(std::move(keepAlive))
     {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
     }
 
-    clearError();
-    if (!globalSession)
+    ~ExternalBlob()
     {
-        setError("Invalid global session");
-        return nullptr;
+        if (m_owned)
+            std::free(const_cast<void *>(m_data));
     }
 
-    auto wrapper = std::make_unique<SlangcSession>();
-
-    SessionDesc sessionDesc = {};
-    std::vector<TargetDesc> targets;
-
-    // Set matrix layout mode
-    sessionDesc.defaultMatrixLayoutMode = desc ? convertMatrixLayoutMode(desc->matrixLayoutMode) : SLANG_MATRIX_LAYOUT_ROW_MAJOR;
-
-    if (desc && desc->targetCount > 0)
+    SLANG_NO_THROW SlangResult SLANG_MCALL queryInterface(SlangUUID const &uuid, void **outObject) override
     {
-        targets.resize(desc->targetCount);
-        for (int32_t i = 0; i < desc->targetCount; i++)
+        if (uuid == ISlangUnknown::getTypeGuid() || uuid == ISlangBlob::getTypeGuid())
         {
-            targets[i].format = convertCompileTarget(desc->targets[i]);
+            addRef();
+            *outObject = static_cast<ISlangBlob *>(this);
+            return SLANG_OK;
         }
-        sessionDesc.targets = targets.data();
-        sessionDesc.targetCount = desc->targetCount;
+        return SLANG_E_NO_INTERFACE;
     }
-    else
+
+    SLANG_NO_THROW uint32_t SLANG_MCALL addRef() override
     {
-        // Default to SPIRV target if none specified
-        targets.resize(1);
-        targets[0].format = SLANG_SPIRV;
-        sessionDesc.targets = targets.data();
-        sessionDesc.targetCount = 1;
+        return ++m_refCount;
     }
 
-    SlangResult result = globalSession->session->createSession(sessionDesc, wrapper->session.writeRef());
-    if (SLANG_FAILED(result))
+    SLANG_NO_THROW uint32_t SLANG_MCALL release() override
     {
-        setError("Failed to create session");
-        return nullptr;
+        uint32_t count = --m_refCount;
+        if (count == 0)
+            delete this;
+        return count;
     }
 
-    return wrapper.release();
-}
+    SLANG_NO_THROW void const *SLANG_MCALL getBufferPointer() override
+    {
+        return m_data;
+    }
+
+    SLANG_NO_THROW size_t SLANG_MCALL getBufferSize() override
+    {
+        return m_size;
+    }
+
+private:
+    const void *m_data;
+    size_t m_size;
+    bool m_owned;
+    std::shared_ptr<const void> m_keepAlive;
+    std::atomic<uint32_t> m_refCount{0};
+};
+
+// Read-only memory mapping of a whole file. Empty files map to a null pointer.
+class MappedFile
+{
+public:
+    static std::shared_ptr<MappedFile> map(const std::filesystem::path &path)
+    {
+        std::shared_ptr<MappedFile> mapped(new MappedFile());
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER size = {};
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+        mapped->m_size = static_cast<size_t>(size.QuadPart);
+
+        if (mapped->m_size > 0)
+        {
+            // The view keeps the mapping and the file alive once both handles are closed
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+            if (mapping)
+                CloseHandle(mapping);
+            if (!view)
+            {
+                CloseHandle(file);
+                return nullptr;
+            }
+            mapped->m_data = static_cast<const uint8_t *>(view);
+        }
+        CloseHandle(file);
+#else
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat info = {};
+        if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode))
+        {
+            close(fd);
+            return nullptr;
+        }
+        mapped->m_size = static_cast<size_t>(info.st_size);
+
+        if (mapped->m_size > 0)
+        {
+            void *view = mmap(nullptr, mapped->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (view == MAP_FAILED)
+            {
+                close(fd);
+                return nullptr;
+            }
+            mapped->m_data = static_cast<const uint8_t *>(view);
+        }
+        close(fd);
+#endif
+        return mapped;
+    }
+
+    ~MappedFile()
+    {
+        if (!m_data)
+            return;
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const uint8_t *data() const
+    {
+        return m_data;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    MappedFile() = default;
+
+    const uint8_t *m_data = nullptr;
+    size_t m_size = 0;
+};
+
+// Packed archive layout: magic, format version, entry count, then per entry the path
+// length (u32), data offset (u64) and data size (u64) followed by the path bytes.
+// File data follows the entry table; offsets are from the start of the archive.
+const char kFileSystemArchiveMagic[4] = {'S', 'L', 'C', 'A'};
+const uint32_t kFileSystemArchiveFormatVersion = 1;
+
+// Slang file system serving files from a memory-mapped packed archive and from the OS.
+// File contents, path types and identities are cached by normalized path so that
+// modules imported from many places are opened once. Shared between sessions, so
+// every cache is guarded by a mutex; file I/O runs outside the lock.
+//
+// Slang keeps source blobs alive and reads them directly, so only the archive, which
+// must not change while in use, is mapped. OS files are copied: an editor that
+// truncates and rewrites a file in place would make a later read of a mapping fault.
+class MappedFileSystem final : public ISlangFileSystemExt
+{
+public:
+    explicit MappedFileSystem(bool allowOSFiles)
+        : m_allowOSFiles(allowOSFiles)
+    {
+    }
+
+    // Maps the archive and indexes its entries. Returns false if it is missing or malformed.
+    bool openArchive(const std::filesystem::path &path)
+    {
+        m_archive = MappedFile::map(path);
+        if (!m_archive)
+            return false;
+
+        const uint8_t *data = m_archive->data();
+        size_t size = m_archive->size();
+        size_t position = 0;
+        auto read = [&](void *out, size_t count)
+        {
+            if (count > size - position)
+                return false;
+            std::memcpy(out, data + position, count);
+            position += count;
+            return true;
+        };
+
+        char magic[4] = {};
+        uint32_t formatVersion = 0;
+        uint32_t entryCount = 0;
+        if (size < sizeof(magic) || !read(magic, sizeof(magic)) ||
+            !std::equal(magic, magic + 4, kFileSystemArchiveMagic) ||
+            !read(&formatVersion, sizeof(formatVersion)) || formatVersion != kFileSystemArchiveFormatVersion ||
+            !read(&entryCount, sizeof(entryCount)))
+            return false;
+
+        for (uint32_t i = 0; i < entryCount; i++)
+        {
+            uint32_t pathLength = 0;
+            ArchiveEntry entry = {};
+            if (!read(&pathLength, sizeof(pathLength)) || !read(&entry.offset, sizeof(entry.offset)) ||
+                !read(&entry.size, sizeof(entry.size)) || pathLength > size - position ||
+                entry.offset > size || entry.size > size - entry.offset)
+                return false;
+
+            std::string entryPath(reinterpret_cast<const char *>(data + position), pathLength);
+            position += pathLength;
+
+            // Record every parent so directory lookups inside the archive succeed
+            for (size_t slash = entryPath.find('/'); slash != std::string::npos; slash = entryPath.find('/', slash + 1))
+                m_archiveDirectories.insert(entryPath.substr(0, slash));
+            m_archiveFiles[entryPath] = entry;
+        }
+        return true;
+    }
+
+    const MappedFile *getArchive() const
+    {
+        return m_archive.get();
+    }
+
+    // Stored form of a path: lexically normalized with forward slashes
+    static std::string normalizePath(const char *path)
+    {
+        std::string normal = std::filesystem::path(path).lexically_normal().generic_string();
+        if (normal.size() > 1 && normal.back() == '/')
+            normal.pop_back();
+        return normal;
+    }
+
+    SLANG_NO_THROW void SLANG_MCALL clearCache() override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_files.clear();
+        m_pathTypes.clear();
+        m_identities.clear();
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL queryInterface(SlangUUID const &uuid, void **outObject) override
+    {
+        void *object = getInterface(uuid);
+        if (!object)
+            return SLANG_E_NO_INTERFACE;
+        addRef();
+        *outObject = object;
+        return SLANG_OK;
+    }
+
+    SLANG_NO_THROW uint32_t SLANG_MCALL addRef() override
+    {
+        return ++m_refCount;
+    }
+
+    SLANG_NO_THROW uint32_t SLANG_MCALL release() override
+    {
+        uint32_t count = --m_refCount;
+        if (count == 0)
+            delete this;
+        return count;
+    }
+
+    SLANG_NO_THROW void *SLANG_MCALL castAs(const SlangUUID &guid) override
+    {
+        return getInterface(guid);
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL loadFile(char const *path, ISlangBlob **outBlob) override
+    {
+        std::string key = normalizePath(path);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_files.find(key);
+            if (it != m_files.end())
+                return returnBlob(it->second, outBlob);
+        }
+
+        Slang::ComPtr<ISlangBlob> blob;
+        auto archiveEntry = m_archiveFiles.find(key);
+        if (archiveEntry != m_archiveFiles.end())
+        {
+            blob = new ExternalBlob(m_archive->data() + archiveEntry->second.offset,
+                                    static_cast<size_t>(archiveEntry->second.size), m_archive);
+        }
+        else if (m_allowOSFiles)
+        {
+            blob = readOSFile(key);
+        }
+
+        // Misses are cached too, since include lookups probe every search path
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return returnBlob(m_files.emplace(key, blob).first->second, outBlob);
+    }
+
+    static Slang::ComPtr<ISlangBlob> readOSFile(const std::string &path)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(path, ec))
+            return nullptr;
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return nullptr;
+        std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (file.bad())
+            return nullptr;
+        return Slang::ComPtr<ISlangBlob>(new OwnedBlob(std::move(data)));
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL getFileUniqueIdentity(const char *path, ISlangBlob **outUniqueIdentity) override
+    {
+        std::string key = normalizePath(path);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_identities.find(key);
+            if (it != m_identities.end())
+                return returnBlob(it->second, outUniqueIdentity);
+        }
+
+        Slang::ComPtr<ISlangBlob> identity;
+        if (m_archiveFiles.count(key))
+        {
+            identity = OwnedBlob::createText("archive:" + key);
+        }
+        else if (m_allowOSFiles)
+        {
+            std::error_code ec;
+            auto canonical = std::filesystem::canonical(key, ec);
+            if (!ec)
+                identity = OwnedBlob::createText(canonical.generic_string());
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return returnBlob(m_identities.emplace(key, identity).first->second, outUniqueIdentity);
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL calcCombinedPath(
+        SlangPathType fromPathType,
+        const char *fromPath,
+        const char *path,
+        ISlangBlob **pathOut) override
+    {
+        std::filesystem::path base(fromPath);
+        if (fromPathType == SLANG_PATH_TYPE_FILE)
+            base = base.parent_path();
+
+        // Joining an absolute path replaces the base
+        std::string combined = (base / path).lexically_normal().generic_string();
+        *pathOut = OwnedBlob::createText(combined);
+        (*pathOut)->addRef();
+        return SLANG_OK;
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL getPathType(const char *path, SlangPathType *pathTypeOut) override
+    {
+        std::string key = normalizePath(path);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_pathTypes.find(key);
+            if (it != m_pathTypes.end())
+            {
+                *pathTypeOut = it->second.type;
+                return it->second.result;
+            }
+        }
+
+        PathTypeEntry entry = {SLANG_E_NOT_FOUND, SLANG_PATH_TYPE_FILE};
+        if (m_archiveFiles.count(key))
+        {
+            entry = {SLANG_OK, SLANG_PATH_TYPE_FILE};
+        }
+        else if (m_archiveDirectories.count(key))
+        {
+            entry = {SLANG_OK, SLANG_PATH_TYPE_DIRECTORY};
+        }
+        else if (m_allowOSFiles)
+        {
+            std::error_code ec;
+            auto status = std::filesystem::status(key, ec);
+            if (!ec && std::filesystem::is_regular_file(status))
+                entry = {SLANG_OK, SLANG_PATH_TYPE_FILE};
+            else if (!ec && std::filesystem::is_directory(status))
+                entry = {SLANG_OK, SLANG_PATH_TYPE_DIRECTORY};
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        entry = m_pathTypes.emplace(key, entry).first->second;
+        *pathTypeOut = entry.type;
+        return entry.result;
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL getPath(PathKind kind, const char *path, ISlangBlob **outPath) override
+    {
+        std::string key = normalizePath(path);
+        bool inArchive = m_archiveFiles.count(key) || m_archiveDirectories.count(key);
+
+        std::string result;
+        switch (kind)
+        {
+        case PathKind::Simplified:
+        case PathKind::Display:
+            result = key;
+            break;
+        case PathKind::Canonical:
+        {
+            if (inArchive)
+            {
+                result = key;
+                break;
+            }
+            std::error_code ec;
+            auto canonical = m_allowOSFiles ? std::filesystem::canonical(key, ec) : std::filesystem::path();
+            if (!m_allowOSFiles || ec)
+                return SLANG_E_NOT_FOUND;
+            result = canonical.generic_string();
+            break;
+        }
+        case PathKind::OperatingSystem:
+        {
+            if (inArchive || !m_allowOSFiles)
+                return SLANG_E_NOT_AVAILABLE;
+            std::error_code ec;
+            auto absolute = std::filesystem::absolute(key, ec);
+            if (ec)
+                return SLANG_E_NOT_FOUND;
+            result = absolute.string();
+            break;
+        }
+        default:
+            return SLANG_E_NOT_IMPLEMENTED;
+        }
+
+        *outPath = OwnedBlob::createText(result);
+        (*outPath)->addRef();
+        return SLANG_OK;
+    }
+
+    SLANG_NO_THROW SlangResult SLANG_MCALL enumeratePathContents(
+        const char *path,
+        FileSystemContentsCallBack callback,
+        void *userData) override
+    {
+        SLANG_UNUSED(path);
+        SLANG_UNUSED(callback);
+        SLANG_UNUSED(userData);
+        return SLANG_E_NOT_IMPLEMENTED;
+    }
+
+    SLANG_NO_THROW OSPathKind SLANG_MCALL getOSPathKind() override
+    {
+        // Archive paths never reach the OS, so only paths from getPath map to real files
+        return m_allowOSFiles ? OSPathKind::OperatingSystem : OSPathKind::None;
+    }
+
+private:
+    struct ArchiveEntry
+    {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct PathTypeEntry
+    {
+        SlangResult result;
+        SlangPathType type;
+    };
+
+    void *getInterface(const SlangUUID &uuid)
+    {
+        if (uuid == ISlangUnknown::getTypeGuid() || uuid == ISlangCastable::getTypeGuid() ||
+            uuid == ISlangFileSystem::getTypeGuid() || uuid == ISlangFileSystemExt::getTypeGuid())
+            return static_cast<ISlangFileSystemExt *>(this);
+        return nullptr;
+    }
+
+    static SlangResult returnBlob(const Slang::ComPtr<ISlangBlob> &blob, ISlangBlob **outBlob)
+    {
+        if (!blob)
+            return SLANG_E_NOT_FOUND;
+        *outBlob = blob.get();
+        blob->addRef();
+        return SLANG_OK;
+    }
+
+    bool m_allowOSFiles;
+
+    // Written only by openArchive, before the file system is shared
+    std::shared_ptr<MappedFile> m_archive;
+    std::unordered_map<std::string, ArchiveEntry> m_archiveFiles;
+    std::unordered_set<std::string> m_archiveDirectories;
+
+    std::mutex m_mutex;
+    std::unordered_map<std::string, Slang::ComPtr<ISlangBlob>> m_files; // Null blob for missing files
+    std::unordered_map<std::string, PathTypeEntry> m_pathTypes;
+    std::unordered_map<std::string, Slang::ComPtr<ISlangBlob>> m_identities;
+    std::atomic<uint32_t> m_refCount{0};
+};
+
+struct SlangcFileSystem
+{
+    uint64_t handleId = g_nextHandleId++;
+    Slang::ComPtr<MappedFileSystem> fileSystem;
+    std::string cacheScope; // Identifies the sources served, for module cache keys
+};
+
+// Thread pool where every worker owns a task deque. Workers pop their own deque from
+// the back and steal from the front of other workers' deques when they run dry.
+class WorkStealingPool
+{
+public:
+    // Tasks receive the index of the worker running them
+    using Task = std::function<void(int32_t workerIndex)>;
+
+    explicit WorkStealingPool(int32_t threadCount)
+        : m_workers(std::max(1, threadCount))
+    {
+        for (int32_t i = 0; i < getThreadCount(); i++)
+            m_workers[i].thread = std::thread([this, i]
+                                              { run(i); });
+    }
+
+    ~WorkStealingPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_workAvailable.notify_all();
+        for (auto &worker : m_workers)
+            worker.thread.join();
+    }
+
+    int32_t getThreadCount() const
+    {
+        return static_cast<int32_t>(m_workers.size());
+    }
+
+    // Queues a task on the preferred worker's deque, or round-robin if preferredWorker is negative
+    void submit(Task task, int32_t preferredWorker = -1)
+    {
+        size_t index = preferredWorker >= 0 ? static_cast<size_t>(preferredWorker) : m_nextWorker++;
+        Worker &worker = m_workers[index % m_workers.size()];
+
+        // Counted before the push, so a thief that runs the task at once cannot underflow the counts
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queuedCount++;
+            m_unfinishedCount++;
+        }
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.tasks.push_back(std::move(task));
+        }
+        m_workAvailable.notify_one();
+    }
+
+    // Blocks until every submitted task has finished
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_allFinished.wait(lock, [this]
+                           { return m_unfinishedCount == 0; });
+    }
+
+private:
+    struct Worker
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+        std::thread thread;
+    };
+
+    bool tryTake(int32_t self, Task &outTask)
+    {
+        {
+            Worker &own = m_workers[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty())
+            {
+                outTask = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+
+        for (size_t i = 1; i < m_workers.size(); i++)
+        {
+            Worker &victim = m_workers[(self + i) % m_workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty())
+            {
+                outTask = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void run(int32_t self)
+    {
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_workAvailable.wait(lock, [this]
+                                     { return m_stop || m_queuedCount > 0; });
+                if (m_stop && m_queuedCount == 0)
+                    return;
+            }
+
+            Task task;
+            if (!tryTake(self, task))
+            {
+                // Another worker took the task between the wake-up and the take
+                std::this_thread::yield();
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_queuedCount--;
+            }
+
+            try
+            {
+                task(self);
+            }
+            catch (...)
+            {
+                // Tasks report their own failures; never let one take down the worker
+            }
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_unfinishedCount == 0)
+                m_allFinished.notify_all();
+        }
+    }
+
+    std::vector<Worker> m_workers;
+    std::atomic<size_t> m_nextWorker{0};
+    std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_allFinished;
+    size_t m_queuedCount = 0;
+    size_t m_unfinishedCount = 0;
+    bool m_stop = false;
+};
+
+// Helper functions
+namespace
+{
+    SlangcResult convertResult(SlangResult result)
+    {
+        switch (result)
+        {
+        case SLANG_OK:
+            return SLANGC_OK;
+        case SLANG_FAIL:
+            return SLANGC_FAIL;
+        case SLANG_E_NOT_IMPLEMENTED:
+            return SLANGC_E_NOT_IMPLEMENTED;
+        case SLANG_E_INVALID_ARG:
+            return SLANGC_E_INVALID_ARG;
+        case SLANG_E_OUT_OF_MEMORY:
+            return SLANGC_E_OUT_OF_MEMORY;
+        case SLANG_E_BUFFER_TOO_SMALL:
+            return SLANGC_E_BUFFER_TOO_SMALL;
+        default:
+            return SLANGC_FAIL;
+        }
+    }
+
+    SlangSourceLanguage convertSourceLanguage(SlangcSourceLanguage lang)
+    {
+        switch (lang)
+        {
+        case SLANGC_SOURCE_LANGUAGE_SLANG:
+            return SLANG_SOURCE_LANGUAGE_SLANG;
+        case SLANGC_SOURCE_LANGUAGE_HLSL:
+            return SLANG_SOURCE_LANGUAGE_HLSL;
+        case SLANGC_SOURCE_LANGUAGE_GLSL:
+            return SLANG_SOURCE_LANGUAGE_GLSL;
+        case SLANGC_SOURCE_LANGUAGE_C:
+            return SLANG_SOURCE_LANGUAGE_C;
+        case SLANGC_SOURCE_LANGUAGE_CPP:
+            return SLANG_SOURCE_LANGUAGE_CPP;
+        default:
+            return SLANG_SOURCE_LANGUAGE_UNKNOWN;
+        }
+    }
+
+    SlangCompileTarget convertCompileTarget(SlangcCompileTarget target)
+    {
+        switch (target)
+        {
+        case SLANGC_TARGET_HLSL:
+            return SLANG_HLSL;
+        case SLANGC_TARGET_GLSL:
+            return SLANG_GLSL;
+        case SLANGC_TARGET_SPIRV:
+            return SLANG_SPIRV;
+        case SLANGC_TARGET_SPIRV_ASM:
+            return SLANG_SPIRV_ASM;
+        case SLANGC_TARGET_DXBC:
+            return SLANG_DXBC;
+        case SLANGC_TARGET_DXBC_ASM:
+            return SLANG_DXBC_ASM;
+        case SLANGC_TARGET_DXIL:
+            return SLANG_DXIL;
+        case SLANGC_TARGET_DXIL_ASM:
+            return SLANG_DXIL_ASM;
+        case SLANGC_TARGET_C_SOURCE:
+            return SLANG_C_SOURCE;
+        case SLANGC_TARGET_CPP_SOURCE:
+            return SLANG_CPP_SOURCE;
+        case SLANGC_TARGET_CUDA_SOURCE:
+            return SLANG_CUDA_SOURCE;
+        case SLANGC_TARGET_PTX:
+            return SLANG_PTX;
+        case SLANGC_TARGET_CUBIN:
+            return SLANG_CUDA_OBJECT_CODE;
+        case SLANGC_TARGET_METAL:
+            return SLANG_METAL;
+        case SLANGC_TARGET_METAL_LIB:
+            return SLANG_METAL_LIB;
+        case SLANGC_TARGET_HOST_CALLABLE:
+            return SLANG_SHADER_HOST_CALLABLE;
+        case SLANGC_TARGET_SHADER_SHARED_LIBRARY:
+            return SLANG_SHADER_SHARED_LIBRARY;
+        case SLANGC_TARGET_SHADER_HOST_CALLABLE:
+            return SLANG_SHADER_HOST_CALLABLE;
+        case SLANGC_TARGET_WGSL:
+            return SLANG_WGSL;
+        default:
+            return SLANG_TARGET_UNKNOWN;
+        }
+    }
+
+    SlangStage convertStage(SlangcStage stage)
+    {
+        switch (stage)
+        {
+        case SLANGC_STAGE_VERTEX:
+            return SLANG_STAGE_VERTEX;
+        case SLANGC_STAGE_HULL:
+            return SLANG_STAGE_HULL;
+        case SLANGC_STAGE_DOMAIN:
+            return SLANG_STAGE_DOMAIN;
+        case SLANGC_STAGE_GEOMETRY:
+            return SLANG_STAGE_GEOMETRY;
+        case SLANGC_STAGE_FRAGMENT:
+            return SLANG_STAGE_FRAGMENT;
+        case SLANGC_STAGE_COMPUTE:
+            return SLANG_STAGE_COMPUTE;
+        case SLANGC_STAGE_RAY_GENERATION:
+            return SLANG_STAGE_RAY_GENERATION;
+        case SLANGC_STAGE_INTERSECTION:
+            return SLANG_STAGE_INTERSECTION;
+        case SLANGC_STAGE_ANY_HIT:
+            return SLANG_STAGE_ANY_HIT;
+        case SLANGC_STAGE_CLOSEST_HIT:
+            return SLANG_STAGE_CLOSEST_HIT;
+        case SLANGC_STAGE_MISS:
+            return SLANG_STAGE_MISS;
+        case SLANGC_STAGE_CALLABLE:
+            return SLANG_STAGE_CALLABLE;
+        case SLANGC_STAGE_MESH:
+            return SLANG_STAGE_MESH;
+        case SLANGC_STAGE_AMPLIFICATION:
+            return SLANG_STAGE_AMPLIFICATION;
+        default:
+            return SLANG_STAGE_NONE;
+        }
+    }
+
+    SlangMatrixLayoutMode convertMatrixLayoutMode(SlangcMatrixLayoutMode mode)
+    {
+        switch (mode)
+        {
+        case SLANGC_MATRIX_LAYOUT_ROW_MAJOR:
+            return SLANG_MATRIX_LAYOUT_ROW_MAJOR;
+        case SLANGC_MATRIX_LAYOUT_COLUMN_MAJOR:
+            return SLANG_MATRIX_LAYOUT_COLUMN_MAJOR;
+        default:
+            return SLANG_MATRIX_LAYOUT_ROW_MAJOR;
+        }
+    }
+
+    // Helper to create a wrapper for diagnostics blob
+    void setDiagnosticsOutput(SlangcBlob **outDiagnostics, Slang::ComPtr<ISlangBlob> &diagnostics)
+    {
+        if (outDiagnostics && diagnostics)
+        {
+            auto diagWrapper = std::make_unique<SlangcBlob>();
+            diagWrapper->blob = diagnostics;
+            *outDiagnostics = diagWrapper.release();
+        }
+    }
+
+    // Splits "NAME" or "NAME=VALUE" macro strings into Slang macro descriptions.
+    // The descriptions point into outStorage, which must outlive them.
+    void parsePreprocessorMacros(
+        const char *const *macros,
+        int32_t macroCount,
+        std::vector<std::string> &outStorage,
+        std::vector<PreprocessorMacroDesc> &outMacros)
+    {
+        outStorage.clear();
+        outMacros.clear();
+        if (!macros || macroCount <= 0)
+            return;
+
+        // Reserve up front so the c_str() pointers stay valid
+        outStorage.reserve(static_cast<size_t>(macroCount) * 2);
+        for (int32_t i = 0; i < macroCount; i++)
+        {
+            if (!macros[i] || !macros[i][0])
+                continue;
+
+            const char *equals = std::strchr(macros[i], '=');
+            if (equals)
+            {
+                outStorage.emplace_back(macros[i], equals);
+                outStorage.emplace_back(equals + 1);
+            }
+            else
+            {
+                outStorage.emplace_back(macros[i]);
+                outStorage.emplace_back();
+            }
+        }
+        for (size_t i = 0; i < outStorage.size(); i += 2)
+            outMacros.push_back({outStorage[i].c_str(), outStorage[i + 1].c_str()});
+    }
+
+    // Canonical form of a macro set: one "NAME=VALUE" line per macro, sorted by name, with
+    // later definitions of a name replacing earlier ones. Equal keys mean equal macro sets.
+    std::string makeMacroKey(const char *const *macros, int32_t macroCount)
+    {
+        std::vector<std::string> storage;
+        std::vector<PreprocessorMacroDesc> parsed;
+        parsePreprocessorMacros(macros, macroCount, storage, parsed);
+
+        std::vector<std::pair<std::string, std::string>> sorted;
+        for (const auto &macro : parsed)
+        {
+            auto it = std::find_if(sorted.begin(), sorted.end(), [&](const std::pair<std::string, std::string> &entry)
+                                   { return entry.first == macro.name; });
+            if (it != sorted.end())
+                it->second = macro.value;
+            else
+                sorted.emplace_back(macro.name, macro.value);
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        std::string key;
+        for (const auto &macro : sorted)
+        {
+            key.append(macro.first);
+            key.push_back('=');
+            key.append(macro.second);
+            key.push_back('\n');
+        }
+        return key;
+    }
+
+    // 64-bit FNV-1a
+    uint64_t hashBytes(const void *data, size_t size)
+    {
+        auto bytes = static_cast<const unsigned char *>(data);
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    uint64_t hashString(const std::string &text)
+    {
+        return hashBytes(text.data(), text.size());
+    }
+
+    // Key covering every setting that affects a session created from the description
+    std::string makeSessionKey(const SlangcSessionDesc *desc)
+    {
+        if (!desc)
+            return std::string();
+
+        std::string key = "targets:";
+        for (int32_t i = 0; i < desc->targetCount; i++)
+            key += std::to_string(static_cast<int>(desc->targets[i])) + ",";
+        key += "\nsearchPaths:";
+        for (int32_t i = 0; desc->searchPaths && i < desc->searchPathCount; i++)
+            key += std::string(desc->searchPaths[i] ? desc->searchPaths[i] : "") + "\n";
+        key += "matrixLayout:" + std::to_string(static_cast<int>(desc->matrixLayoutMode));
+        key += "\ncache:" + std::to_string(desc->cache ? desc->cache->handleId : 0);
+        key += "\nfileSystem:" + std::to_string(desc->fileSystem ? desc->fileSystem->handleId : 0);
+        key += "\ntimingProfile:" + std::to_string(desc->timingProfile ? desc->timingProfile->handleId : 0);
+        key += "\nwholeProgram:" + std::to_string(desc->generateWholeProgram ? 1 : 0);
+        key += "\nmacros:\n" + makeMacroKey(desc->preprocessorMacros, desc->preprocessorMacroCount);
+        return key;
+    }
+
+    // Like makeSessionKey, but without the per-process handles, so it can key entries on disk
+    std::string makeModuleCacheScope(const SlangcSessionDesc *desc, SlangProfileID profile)
+    {
+        std::string key = "targets:";
+        for (int32_t i = 0; i < desc->targetCount; i++)
+            key += std::to_string(static_cast<int>(desc->targets[i])) + ",";
+        key += "\nsearchPaths:";
+        for (int32_t i = 0; desc->searchPaths && i < desc->searchPathCount; i++)
+            key += std::string(desc->searchPaths[i] ? desc->searchPaths[i] : "") + "\n";
+        key += "matrixLayout:" + std::to_string(static_cast<int>(desc->matrixLayoutMode));
+        key += "\nwholeProgram:" + std::to_string(desc->generateWholeProgram ? 1 : 0);
+        key += "\nprofile:" + std::to_string(static_cast<int>(profile));
+        key += "\nfileSystem:" + (desc->fileSystem ? desc->fileSystem->cacheScope : std::string("default"));
+        key += "\nmacros:\n" + makeMacroKey(desc->preprocessorMacros, desc->preprocessorMacroCount);
+        return key;
+    }
+
+    // Creates a session honoring every field of the description, including search paths
+    // and preprocessor macros. SLANG_PROFILE_UNKNOWN leaves the target profiles unset.
+    SlangcSession *createSessionFromDesc(
+        SlangcGlobalSession *globalSession,
+        const SlangcSessionDesc *desc,
+        SlangProfileID profile)
+    {
+        auto wrapper = std::make_unique<SlangcSession>();
+
+        SessionDesc sessionDesc = {};
+        std::vector<TargetDesc> targets;
+        std::vector<std::string> macroStorage;
+        std::vector<PreprocessorMacroDesc> macros;
+
+        sessionDesc.defaultMatrixLayoutMode = desc ? convertMatrixLayoutMode(desc->matrixLayoutMode) : SLANG_MATRIX_LAYOUT_ROW_MAJOR;
+
+        if (desc && desc->targetCount > 0)
+        {
+            targets.resize(desc->targetCount);
+            for (int32_t i = 0; i < desc->targetCount; i++)
+            {
+                targets[i].format = convertCompileTarget(desc->targets[i]);
+                if (profile != SLANG_PROFILE_UNKNOWN)
+                    targets[i].profile = profile;
+            }
+        }
+        else
+        {
+            // Default to SPIRV target if none specified
+            targets.resize(1);
+            targets[0].format = SLANG_SPIRV;
+            if (profile != SLANG_PROFILE_UNKNOWN)
+                targets[0].profile = profile;
+        }
+        sessionDesc.targets = targets.data();
+        sessionDesc.targetCount = static_cast<SlangInt>(targets.size());
+        if (desc && desc->targetCount > 0)
+            wrapper->targets.assign(desc->targets, desc->targets + desc->targetCount);
+        else
+            wrapper->targets.push_back(SLANGC_TARGET_SPIRV);
+
+        if (desc && desc->searchPaths && desc->searchPathCount > 0)
+        {
+            sessionDesc.searchPaths = desc->searchPaths;
+            sessionDesc.searchPathCount = desc->searchPathCount;
+        }
+
+        if (desc)
+        {
+            parsePreprocessorMacros(desc->preprocessorMacros, desc->preprocessorMacroCount, macroStorage, macros);
+            sessionDesc.preprocessorMacros = macros.data();
+            sessionDesc.preprocessorMacroCount = static_cast<SlangInt>(macros.size());
+        }
+
+        // The session holds its own reference, so the wrapper may be released first
+        if (desc && desc->fileSystem)
+            sessionDesc.fileSystem = desc->fileSystem->fileSystem;
+
+        std::vector<CompilerOptionEntry> options;
+        auto enableOption = [&](CompilerOptionName name)
+        {
+            CompilerOptionEntry entry = {};
+            entry.name = name;
+            entry.value.intValue0 = 1;
+            options.push_back(entry);
+        };
+
+        // Slang's own timing reports, picked out of the diagnostics by ProfileScope
+        if (desc && desc->timingProfile)
+        {
+            enableOption(CompilerOptionName::ReportDownstreamTime);
+            enableOption(CompilerOptionName::ReportPerfBenchmark);
+        }
+        if (desc && desc->generateWholeProgram)
+            enableOption(CompilerOptionName::GenerateWholeProgram);
+
+        sessionDesc.compilerOptionEntries = options.data();
+        sessionDesc.compilerOptionEntryCount = static_cast<uint32_t>(options.size());
+
+        SlangResult result = globalSession->session->createSession(sessionDesc, wrapper->session.writeRef());
+        if (SLANG_FAILED(result))
+        {
+            setError("Failed to create session");
+            return nullptr;
+        }
+
+        if (desc && desc->cache)
+        {
+            wrapper->cache = desc->cache;
+            wrapper->buildTag = globalSession->session->getBuildTagString();
+            if (desc->cache->cacheModules)
+                wrapper->moduleCacheScope = makeModuleCacheScope(desc, profile);
+        }
+
+        wrapper->profile = desc ? desc->timingProfile : nullptr;
+        wrapper->macroFingerprint = hashString(
+            desc ? makeMacroKey(desc->preprocessorMacros, desc->preprocessorMacroCount) : std::string());
+
+        return wrapper.release();
+    }
+
+    // CPU time consumed by the calling thread
+    double getThreadCpuSeconds()
+    {
+#ifdef _WIN32
+        FILETIME creationTime, exitTime, kernelTime, userTime;
+        if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+            return 0.0;
+        auto toSeconds = [](const FILETIME &time)
+        {
+            return (static_cast<double>(time.dwHighDateTime) * 4294967296.0 + time.dwLowDateTime) * 1e-7;
+        };
+        return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+        timespec time = {};
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+        return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+#endif
+    }
+
+    // Parses a "name: <count> <milliseconds>ms" line of Slang's performance benchmark report
+    bool parseBenchmarkLine(const std::string &line, SlangcProfile::BenchmarkEntry &outEntry)
+    {
+        size_t colon = line.rfind(':');
+        if (colon == std::string::npos || colon == 0)
+            return false;
+
+        std::istringstream fields(line.substr(colon + 1));
+        std::string milliseconds;
+        if (!(fields >> outEntry.invocationCount >> milliseconds) || milliseconds.size() < 3 ||
+            milliseconds.compare(milliseconds.size() - 2, 2, "ms") != 0)
+            return false;
+
+        char *end = nullptr;
+        outEntry.milliseconds = std::strtod(milliseconds.c_str(), &end);
+        if (end != milliseconds.c_str() + milliseconds.size() - 2)
+            return false;
+
+        size_t nameBegin = line.find_first_not_of(" \t");
+        size_t nameEnd = line.find_last_not_of(" \t", colon - 1);
+        if (nameBegin == std::string::npos || nameEnd == std::string::npos || nameBegin > nameEnd)
+            return false;
+        outEntry.name = line.substr(nameBegin, nameEnd - nameBegin + 1);
+        return true;
+    }
+
+    // Matches a line that is exactly one of Slang's report notes: the header, optionally
+    // after a diagnostic "...note: " prefix. Returns the offset just past the header.
+    size_t matchReportHeader(const std::string &line, const char *header)
+    {
+        size_t position = line.find(header);
+        if (position == std::string::npos)
+            return std::string::npos;
+        if (position > 0)
+        {
+            static const char kNotePrefix[] = "note: ";
+            size_t prefixLength = sizeof(kNotePrefix) - 1;
+            if (position < prefixLength || line.compare(position - prefixLength, prefixLength, kNotePrefix) != 0)
+                return std::string::npos;
+        }
+        return position + std::strlen(header);
+    }
+
+    // "downstream compile time: <seconds>s", the whole line
+    bool isDownstreamTimeReport(const std::string &line)
+    {
+        size_t valueBegin = matchReportHeader(line, "downstream compile time: ");
+        if (valueBegin == std::string::npos)
+            return false;
+
+        std::string value = line.substr(valueBegin);
+        while (!value.empty() && (value.back() == '\r' || value.back() == ' '))
+            value.pop_back();
+        char *end = nullptr;
+        std::strtod(value.c_str(), &end);
+        return end != value.c_str() && end == value.c_str() + value.size() - 1 && value.back() == 's';
+    }
+
+    // "performance benchmark:" with nothing after it; the entries follow on their own lines
+    bool isBenchmarkReportHeader(const std::string &line)
+    {
+        size_t end = matchReportHeader(line, "performance benchmark:");
+        return end != std::string::npos && line.find_first_not_of(" \t\r", end) == std::string::npos;
+    }
+
+    // Times one wrapper call into the profile of the session it runs on. Without a
+    // profile it does nothing, so untimed sessions pay only for the null check.
+    class ProfileScope
+    {
+    public:
+        ProfileScope(SlangcSession *session, SlangcProfilePhase phase)
+            : m_profile(session ? session->profile : nullptr), m_phase(phase)
+        {
+            if (!m_profile)
+                return;
+
+            m_globalSession = session->session->getGlobalSession();
+            m_globalSession->getCompilerElapsedTime(&m_startCompilerSeconds, &m_startDownstreamSeconds);
+            m_startCpuSeconds = getThreadCpuSeconds();
+            m_startTime = std::chrono::steady_clock::now();
+        }
+
+        ~ProfileScope()
+        {
+            if (!m_profile)
+                return;
+
+            double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+            double cpuSeconds = getThreadCpuSeconds() - m_startCpuSeconds;
+            double compilerSeconds = 0.0;
+            double downstreamSeconds = 0.0;
+            m_globalSession->getCompilerElapsedTime(&compilerSeconds, &downstreamSeconds);
+
+            std::lock_guard<std::mutex> lock(m_profile->mutex);
+            SlangcProfilePhaseStats &stats = m_profile->phases[m_phase];
+            stats.callCount++;
+            stats.wallSeconds += wallSeconds;
+            stats.cpuSeconds += cpuSeconds;
+            stats.compilerSeconds += compilerSeconds - m_startCompilerSeconds;
+            stats.downstreamSeconds += downstreamSeconds - m_startDownstreamSeconds;
+        }
+
+        ProfileScope(const ProfileScope &) = delete;
+        ProfileScope &operator=(const ProfileScope &) = delete;
+
+        // Moves Slang's downstream time and performance benchmark reports out of the
+        // diagnostics. Downstream time is already covered by getCompilerElapsedTime, so
+        // only benchmark entries are recorded; other diagnostics are left untouched.
+        void captureReports(Slang::ComPtr<ISlangBlob> &diagnostics)
+        {
+            if (!m_profile || !diagnostics)
+                return;
+
+            std::string text(static_cast<const char *>(diagnostics->getBufferPointer()), diagnostics->getBufferSize());
+            std::string remaining;
+            std::vector<SlangcProfile::BenchmarkEntry> entries;
+            bool changed = false;
+
+            // Only the report notes themselves and the entry lines directly under the
+            // benchmark header are removed; every other byte is kept as it was
+            bool inBenchmarkReport = false;
+            for (size_t begin = 0; begin < text.size();)
+            {
+                size_t newline = text.find('\n', begin);
+                size_t end = newline == std::string::npos ? text.size() : newline + 1;
+                std::string line = text.substr(begin, (newline == std::string::npos ? text.size() : newline) - begin);
+
+                SlangcProfile::BenchmarkEntry entry;
+                if (inBenchmarkReport && parseBenchmarkLine(line, entry))
+                {
+                    entries.push_back(std::move(entry));
+                    changed = true;
+                }
+                else if (isBenchmarkReportHeader(line))
+                {
+                    inBenchmarkReport = true;
+                    changed = true;
+                }
+                else if (isDownstreamTimeReport(line))
+                {
+                    inBenchmarkReport = false;
+                    changed = true;
+                }
+                else
+                {
+                    inBenchmarkReport = false;
+                    remaining.append(text, begin, end - begin);
+                }
+                begin = end;
+            }
+            if (!changed)
+                return;
+
+            {
+                std::lock_guard<std::mutex> lock(m_profile->mutex);
+                for (auto &entry : entries)
+                {
+                    auto it = m_profile->benchmarkIndices.find(entry.name);
+                    if (it == m_profile->benchmarkIndices.end())
+                    {
+                        m_profile->benchmarkIndices.emplace(entry.name, m_profile->benchmarkEntries.size());
+                        m_profile->benchmarkEntries.push_back(std::move(entry));
+                        continue;
+                    }
+                    auto &existing = m_profile->benchmarkEntries[it->second];
+                    existing.invocationCount += entry.invocationCount;
+                    existing.milliseconds += entry.milliseconds;
+                }
+            }
+
+            if (remaining.find_first_not_of(" \t\r\n") == std::string::npos)
+                diagnostics = nullptr;
+            else
+                diagnostics = OwnedBlob::createText(remaining);
+        }
+
+    private:
+        SlangcProfile *m_profile;
+        SlangcProfilePhase m_phase;
+        IGlobalSession *m_globalSession = nullptr;
+        double m_startCompilerSeconds = 0.0;
+        double m_startDownstreamSeconds = 0.0;
+        double m_startCpuSeconds = 0.0;
+        std::chrono::steady_clock::time_point m_startTime;
+    };
+
+    // Name of a compile target as accepted by slangc's -target option
+    const char *getCompileTargetName(int32_t target)
+    {
+        static const char *const names[] = {
+            "unknown", "none", "hlsl", "glsl", "spirv", "spirv-asm", "dxbc", "dxbc-asm", "dxil", "dxil-asm",
+            "c", "cpp", "cuda", "ptx", "cubin", "metal", "metallib", "host-callable", "shader-sharedlib",
+            "shader-host-callable", "wgsl"};
+        if (target < 0 || target >= static_cast<int32_t>(sizeof(names) / sizeof(names[0])))
+            return "unknown";
+        return names[target];
+    }
+
+    // Tracing keeps one ring buffer of events per thread. Only the owning thread writes
+    // to a buffer, so recording an event takes no lock; the registry mutex is taken once
+    // per thread per trace, and by slangc_beginTrace and slangc_endTrace.
+    const uint32_t kDefaultTraceEventsPerThread = 65536;
+    const size_t kTraceNameLength = 64;
+
+    struct TraceEvent
+    {
+        const char *name; // Static string naming the wrapper call
+        int64_t startMicroseconds;
+        int64_t durationMicroseconds;
+        int32_t target; // SlangcCompileTarget, or -1 when the call has no target
+        char moduleName[kTraceNameLength];
+        char entryPointName[kTraceNameLength];
+    };
+
+    // Once full, the oldest events are overwritten
+    struct TraceBuffer
+    {
+        TraceBuffer(uint32_t capacity, uint32_t threadId, uint64_t generation, std::chrono::steady_clock::time_point startTime)
+            : events(new TraceEvent[capacity]), capacity(capacity), threadId(threadId),
+              osThreadId(std::hash<std::thread::id>()(std::this_thread::get_id())),
+              generation(generation), startTime(startTime)
+        {
+        }
+
+        std::unique_ptr<TraceEvent[]> events;
+        uint32_t capacity;
+        uint32_t threadId; // Small id used as the trace "tid"
+        size_t osThreadId;
+        uint64_t generation; // Trace the buffer was registered with
+        std::chrono::steady_clock::time_point startTime;
+        std::atomic<uint64_t> writeCount{0};
+        std::atomic<bool> writing{false}; // Set while the owner writes, so slangc_endTrace can wait
+    };
+
+    struct TraceRegistry
+    {
+        std::mutex mutex;
+        std::vector<std::shared_ptr<TraceBuffer>> buffers;
+        uint32_t eventsPerThread = kDefaultTraceEventsPerThread;
+        std::atomic<uint64_t> generation{0}; // Bumped by every slangc_beginTrace
+        std::chrono::steady_clock::time_point startTime;
+    };
+
+    std::atomic<bool> g_traceEnabled{false};
+
+    TraceRegistry &getTraceRegistry()
+    {
+        static TraceRegistry registry;
+        return registry;
+    }
+
+    thread_local std::shared_ptr<TraceBuffer> t_traceBuffer;
+
+    void copyTraceName(char (&destination)[kTraceNameLength], const char *name)
+    {
+        size_t length = name ? std::min(std::strlen(name), kTraceNameLength - 1) : 0;
+        std::memcpy(destination, name ? name : "", length);
+        destination[length] = '\0';
+    }
+
+    void recordTraceEvent(
+        TraceEvent &event,
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end)
+    {
+        // Registration happens once per thread per trace
+        TraceRegistry &registry = getTraceRegistry();
+        if (!t_traceBuffer || t_traceBuffer->generation != registry.generation.load())
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            if (!g_traceEnabled)
+                return;
+            t_traceBuffer = std::make_shared<TraceBuffer>(
+                registry.eventsPerThread,
+                static_cast<uint32_t>(registry.buffers.size()) + 1,
+                registry.generation.load(),
+                registry.startTime);
+            registry.buffers.push_back(t_traceBuffer);
+        }
+
+        // A buffer left over from an ended trace may still be written; it is simply never read
+        TraceBuffer &buffer = *t_traceBuffer;
+        buffer.writing.store(true);
+        if (g_traceEnabled.load())
+        {
+            event.startMicroseconds = std::max<int64_t>(
+                0, std::chrono::duration_cast<std::chrono::microseconds>(start - buffer.startTime).count());
+            event.durationMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+            uint64_t index = buffer.writeCount.load(std::memory_order_relaxed);
+            buffer.events[index % buffer.capacity] = event;
+            buffer.writeCount.store(index + 1, std::memory_order_release);
+        }
+        buffer.writing.store(false);
+    }
+
+    // Records one wrapper call as a complete trace event. When tracing is off this is a
+    // single relaxed load; the setters are also no-ops so callers need not check.
+    class TraceScope
+    {
+    public:
+        explicit TraceScope(const char *name)
+            : m_active(g_traceEnabled.load(std::memory_order_relaxed))
+        {
+            if (!m_active)
+                return;
+
+            m_event.name = name;
+            m_event.target = -1;
+            m_event.moduleName[0] = '\0';
+            m_event.entryPointName[0] = '\0';
+            m_start = std::chrono::steady_clock::now();
+        }
+
+        ~TraceScope()
+        {
+            if (m_active)
+                recordTraceEvent(m_event, m_start, std::chrono::steady_clock::now());
+        }
+
+        TraceScope(const TraceScope &) = delete;
+        TraceScope &operator=(const TraceScope &) = delete;
+
+        bool isActive() const
+        {
+            return m_active;
+        }
+
+        void setModuleName(const char *name)
+        {
+            if (m_active)
+                copyTraceName(m_event.moduleName, name);
+        }
+
+        void setEntryPointName(const char *name)
+        {
+            if (m_active)
+                copyTraceName(m_event.entryPointName, name);
+        }
+
+        void setTarget(int32_t target)
+        {
+            if (m_active)
+                m_event.target = target;
+        }
+
+    private:
+        bool m_active;
+        TraceEvent m_event;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    // Collects the module and entry point names of components for a trace event
+    void collectTraceNames(
+        const SlangcComponentType *componentTypes,
+        int32_t componentTypeCount,
+        std::string &outModuleNames,
+        std::vector<std::string> &outEntryPointNames)
+    {
+        auto appendModuleName = [&](const std::string &name)
+        {
+            if (name.empty())
+                return;
+            if (!outModuleNames.empty())
+                outModuleNames += ',';
+            outModuleNames += name;
+        };
+
+        for (int32_t i = 0; i < componentTypeCount; i++)
+        {
+            const SlangcComponentType &component = componentTypes[i];
+            switch (component.kind)
+            {
+            case SLANGC_COMPONENT_TYPE_MODULE:
+                if (component.module)
+                    appendModuleName(component.module->module->getName());
+                break;
+            case SLANGC_COMPONENT_TYPE_ENTRY_POINT:
+                if (component.entryPoint)
+                {
+                    auto function = component.entryPoint->entryPoint->getFunctionReflection();
+                    const char *name = function ? function->getName() : nullptr;
+                    outEntryPointNames.push_back(name ? name : "");
+                }
+                break;
+            case SLANGC_COMPONENT_TYPE_COMPOSITE:
+                if (component.composite)
+                {
+                    auto composite = static_cast<const SlangcComposite *>(component.composite);
+                    appendModuleName(composite->traceModuleNames);
+                    outEntryPointNames.insert(
+                        outEntryPointNames.end(),
+                        composite->traceEntryPointNames.begin(),
+                        composite->traceEntryPointNames.end());
+                }
+                break;
+            case SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE:
+                break;
+            }
+        }
+    }
+
+    void appendJsonString(std::string &out, const char *text)
+    {
+        out += '"';
+        for (const char *c = text; *c; c++)
+        {
+            switch (*c)
+            {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                    out += escaped;
+                }
+                else
+                {
+                    out += *c;
+                }
+                break;
+            }
+        }
+        out += '"';
+    }
+
+    // Tagged file layout: magic, format version, build tag length, build tag, payload.
+    // The build tag ties the payload to the Slang build that produced it.
+    const uint32_t kTaggedFileFormatVersion = 1;
+    const char kCacheMagic[4] = {'S', 'L', 'C', 'C'};
+    const char kCoreModuleSnapshotMagic[4] = {'S', 'L', 'C', 'S'};
+    const char *kCacheEntryExtension = ".slangc-cache";
+
+    bool readTaggedFile(
+        const std::filesystem::path &path,
+        const char (&expectedMagic)[4],
+        const std::string &buildTag,
+        std::vector<uint8_t> &outData)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return false;
+
+        char magic[4] = {};
+        uint32_t formatVersion = 0;
+        uint32_t tagLength = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char *>(&formatVersion), sizeof(formatVersion));
+        file.read(reinterpret_cast<char *>(&tagLength), sizeof(tagLength));
+        if (!file || !std::equal(magic, magic + 4, expectedMagic) ||
+            formatVersion != kTaggedFileFormatVersion || tagLength != buildTag.size())
+            return false;
+
+        std::string tag(tagLength, '\0');
+        file.read(tag.data(), tag.size());
+        if (!file || tag != buildTag)
+            return false;
+
+        outData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    std::atomic<uint64_t> g_nextTempFileId{0};
+
+    uint64_t getProcessId()
+    {
+#ifdef _WIN32
+        return GetCurrentProcessId();
+#else
+        return static_cast<uint64_t>(getpid());
+#endif
+    }
+
+    // Writes to a temporary file unique to this process and call, and renames it so readers
+    // never see partial files. The cache directory may be shared by several processes.
+    template <typename WriteContents>
+    bool replaceFile(const std::filesystem::path &path, WriteContents &&writeContents)
+    {
+        std::filesystem::path tempPath = path;
+        tempPath += "." + std::to_string(getProcessId()) + "." + std::to_string(g_nextTempFileId++) + ".tmp";
+
+        std::error_code ec;
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+                return false;
+
+            writeContents(file);
+            if (!file)
+            {
+                file.close();
+                std::filesystem::remove(tempPath, ec);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    bool writeTaggedFile(
+        const std::filesystem::path &path,
+        const char (&magic)[4],
+        const std::string &buildTag,
+        const void *data,
+        size_t size)
+    {
+        return replaceFile(path, [&](std::ofstream &file)
+                           {
+            uint32_t tagLength = static_cast<uint32_t>(buildTag.size());
+            file.write(magic, sizeof(magic));
+            file.write(reinterpret_cast<const char *>(&kTaggedFileFormatVersion), sizeof(kTaggedFileFormatVersion));
+            file.write(reinterpret_cast<const char *>(&tagLength), sizeof(tagLength));
+            file.write(buildTag.data(), buildTag.size());
+            file.write(static_cast<const char *>(data), size); });
+    }
+
+    // Escapes a path for a Makefile rule as read by both Make and Ninja
+    void appendDepfilePath(std::string &out, const char *path)
+    {
+        for (const char *c = path; *c; c++)
+        {
+            if (*c == ' ' || *c == '#')
+                out += '\\';
+            else if (*c == '$')
+                out += '$';
+            out += *c;
+        }
+    }
+
+    // Writes a Makefile rule naming every file the modules behind a component type read,
+    // replacing the depfile only once it is complete
+    bool writeDepfile(const SlangcComponentType *componentType, const char *targetPath, const char *depfilePath)
+    {
+        std::vector<Slang::ComPtr<IModule>> modules;
+        collectComponentModules(componentType, 1, modules);
+
+        std::string rule;
+        appendDepfilePath(rule, targetPath);
+        rule += ':';
+
+        std::unordered_set<std::string> seen;
+        for (const auto &module : modules)
+        {
+            for (int32_t i = 0; i < module->getDependencyFileCount(); i++)
+            {
+                const char *path = module->getDependencyFilePath(i);
+                if (!path || !path[0] || !seen.insert(path).second)
+                    continue;
+                rule += " \\\n  ";
+                appendDepfilePath(rule, path);
+            }
+        }
+        rule += '\n';
+
+        return replaceFile(depfilePath, [&rule](std::ofstream &file)
+                           { file.write(rule.data(), rule.size()); });
+    }
+
+    // Creates a global session whose core module is loaded from a snapshot file. When the
+    // snapshot is missing or was written by a different Slang build, the core module is
+    // built the usual way and a fresh snapshot is saved for the next start.
+    SlangResult createGlobalSessionFromSnapshot(
+        uint32_t apiVersion,
+        const char *snapshotPath,
+        Slang::ComPtr<IGlobalSession> &outSession)
+    {
+        Slang::ComPtr<IGlobalSession> session;
+        SLANG_RETURN_ON_FAIL(slang_createGlobalSessionWithoutCoreModule(apiVersion, session.writeRef()));
+        std::string buildTag = session->getBuildTagString();
+
+        std::vector<uint8_t> snapshot;
+        if (readTaggedFile(snapshotPath, kCoreModuleSnapshotMagic, buildTag, snapshot) &&
+            SLANG_SUCCEEDED(session->loadBuiltinModule(BuiltinModuleName::Core, snapshot.data(), snapshot.size())))
+        {
+            outSession = session;
+            return SLANG_OK;
+        }
+
+        // A failed load can leave the session partially initialized, so start from scratch
+        session.setNull();
+        SLANG_RETURN_ON_FAIL(slang_createGlobalSession(apiVersion, session.writeRef()));
+
+        Slang::ComPtr<ISlangBlob> blob;
+        if (SLANG_SUCCEEDED(session->saveBuiltinModule(BuiltinModuleName::Core, SLANG_ARCHIVE_TYPE_RIFF_LZ4, blob.writeRef())) && blob)
+        {
+            writeTaggedFile(snapshotPath, kCoreModuleSnapshotMagic, buildTag, blob->getBufferPointer(), blob->getBufferSize());
+        }
+
+        outSession = session;
+        return SLANG_OK;
+    }
+
+    std::string hashToHex(ISlangBlob *hash)
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string hex;
+        if (!hash)
+            return hex;
+
+        auto bytes = static_cast<const uint8_t *>(hash->getBufferPointer());
+        size_t size = hash->getBufferSize();
+        hex.reserve(size * 2);
+        for (size_t i = 0; i < size; i++)
+        {
+            hex.push_back(digits[bytes[i] >> 4]);
+            hex.push_back(digits[bytes[i] & 0xf]);
+        }
+        return hex;
+    }
+
+    std::filesystem::path getCacheEntryPath(SlangcCache *cache, const std::string &key)
+    {
+        return cache->directory / (key + kCacheEntryExtension);
+    }
+
+    // Must be called with the cache mutex held
+    void removeCacheEntryLocked(SlangcCache *cache, const std::string &key)
+    {
+        auto it = cache->entries.find(key);
+        if (it == cache->entries.end())
+            return;
+
+        std::error_code ec;
+        std::filesystem::remove(getCacheEntryPath(cache, key), ec);
+        cache->totalSizeBytes -= it->second.size;
+        cache->lru.erase(it->second.lruPosition);
+        cache->entries.erase(it);
+    }
+
+    // Must be called with the cache mutex held
+    void evictCacheEntriesLocked(SlangcCache *cache)
+    {
+        if (cache->maxSizeBytes == 0)
+            return;
+
+        while (cache->totalSizeBytes > cache->maxSizeBytes && !cache->lru.empty())
+        {
+            removeCacheEntryLocked(cache, cache->lru.back());
+            cache->evictionCount++;
+        }
+    }
+
+    void scanCacheDirectory(SlangcCache *cache)
+    {
+        struct ScannedEntry
+        {
+            std::filesystem::file_time_type lastUsed;
+            std::string key;
+            uint64_t size;
+        };
+        std::vector<ScannedEntry> scanned;
+
+        std::error_code ec;
+        for (const auto &file : std::filesystem::directory_iterator(cache->directory, ec))
+        {
+            if (!file.is_regular_file(ec) || file.path().extension() != kCacheEntryExtension)
+                continue;
+
+            ScannedEntry entry;
+            entry.lastUsed = file.last_write_time(ec);
+            entry.key = file.path().stem().string();
+            entry.size = file.file_size(ec);
+            if (!ec)
+                scanned.push_back(std::move(entry));
+        }
+
+        // Oldest first so the most recently used entry ends up at the front of the list
+        std::sort(scanned.begin(), scanned.end(), [](const ScannedEntry &a, const ScannedEntry &b)
+                  { return a.lastUsed < b.lastUsed; });
+        for (auto &entry : scanned)
+        {
+            cache->lru.push_front(entry.key);
+            cache->entries[entry.key] = {entry.size, cache->lru.begin()};
+            cache->totalSizeBytes += entry.size;
+        }
+    }
+
+    // Counts the access as a code hit or miss unless countAccess is false
+    Slang::ComPtr<ISlangBlob> loadCacheEntry(
+        SlangcCache *cache,
+        const std::string &key,
+        const std::string &buildTag,
+        bool countAccess = true)
+    {
+        std::filesystem::path path = getCacheEntryPath(cache, key);
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            auto it = cache->entries.find(key);
+            if (it == cache->entries.end())
+            {
+                if (countAccess)
+                    cache->missCount++;
+                return nullptr;
+            }
+            cache->lru.splice(cache->lru.begin(), cache->lru, it->second.lruPosition);
+        }
+
+        // Record the access on disk so LRU order survives process restarts
+        std::error_code ec;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), ec);
+
+        std::vector<uint8_t> code;
+        bool valid = readTaggedFile(path, kCacheMagic, buildTag, code);
+
+        std::lock_guard<std::mutex> lock(cache->mutex);
+        if (!valid)
+        {
+            // Unreadable or produced by a different Slang build
+            removeCacheEntryLocked(cache, key);
+            if (countAccess)
+                cache->missCount++;
+            return nullptr;
+        }
+
+        if (countAccess)
+            cache->hitCount++;
+        return Slang::ComPtr<ISlangBlob>(new OwnedBlob(std::move(code)));
+    }
+
+    void storeCacheEntry(SlangcCache *cache, const std::string &key, const std::string &buildTag, ISlangBlob *code)
+    {
+        std::filesystem::path path = getCacheEntryPath(cache, key);
+
+        if (!writeTaggedFile(path, kCacheMagic, buildTag, code->getBufferPointer(), code->getBufferSize()))
+            return;
+
+        std::error_code ec;
+        uint64_t size = std::filesystem::file_size(path, ec);
+        if (ec)
+            return;
+
+        std::lock_guard<std::mutex> lock(cache->mutex);
+        auto it = cache->entries.find(key);
+        if (it != cache->entries.end())
+        {
+            cache->totalSizeBytes -= it->second.size;
+            cache->lru.erase(it->second.lruPosition);
+            cache->entries.erase(it);
+        }
+        cache->lru.push_front(key);
+        cache->entries[key] = {size, cache->lru.begin()};
+        cache->totalSizeBytes += size;
+        evictCacheEntriesLocked(cache);
+    }
+
+    // Module cache entry payload: the name the module was requested by, its own name,
+    // its source path, import count and the names of the modules it imports (in the
+    // order they were loaded), then the serialized module. Counts are u32; strings are
+    // a u32 length followed by the bytes.
+    struct ModuleCacheEntry
+    {
+        std::string requestedName; // Name or path passed to slangc_loadModule
+        std::string name;
+        std::string path;
+        std::vector<std::string> dependencies;
+        Slang::ComPtr<ISlangBlob> module;
+    };
+
+    std::string getModuleCacheKey(SlangcSession *session, const std::string &moduleName)
+    {
+        uint64_t hash = hashString(session->moduleCacheScope + '\0' + moduleName);
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+        return std::string("module-") + hex;
+    }
+
+    void appendCacheU32(std::vector<uint8_t> &out, uint32_t value)
+    {
+        auto bytes = reinterpret_cast<const uint8_t *>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(value));
+    }
+
+    void appendCacheString(std::vector<uint8_t> &out, const std::string &text)
+    {
+        appendCacheU32(out, static_cast<uint32_t>(text.size()));
+        out.insert(out.end(), text.begin(), text.end());
+    }
+
+    bool readCacheU32(const uint8_t *&data, const uint8_t *end, uint32_t &outValue)
+    {
+        if (static_cast<size_t>(end - data) < sizeof(outValue))
+            return false;
+        std::memcpy(&outValue, data, sizeof(outValue));
+        data += sizeof(outValue);
+        return true;
+    }
+
+    bool readCacheString(const uint8_t *&data, const uint8_t *end, std::string &outText)
+    {
+        uint32_t length = 0;
+        if (!readCacheU32(data, end, length) || static_cast<size_t>(end - data) < length)
+            return false;
+        outText.assign(reinterpret_cast<const char *>(data), length);
+        data += length;
+        return true;
+    }
+
+    void appendCacheStrings(std::vector<uint8_t> &out, const std::vector<std::string> &strings)
+    {
+        appendCacheU32(out, static_cast<uint32_t>(strings.size()));
+        for (const std::string &text : strings)
+            appendCacheString(out, text);
+    }
+
+    bool readCacheStrings(const uint8_t *&data, const uint8_t *end, std::vector<std::string> &outStrings)
+    {
+        uint32_t count = 0;
+        // Every string takes at least its length prefix, which bounds a corrupt count
+        if (!readCacheU32(data, end, count) || count > static_cast<size_t>(end - data) / sizeof(uint32_t))
+            return false;
+
+        outStrings.resize(count);
+        for (std::string &text : outStrings)
+        {
+            if (!readCacheString(data, end, text))
+                return false;
+        }
+        return true;
+    }
+
+    bool loadModuleCacheEntry(SlangcSession *session, const std::string &moduleName, ModuleCacheEntry &outEntry)
+    {
+        Slang::ComPtr<ISlangBlob> blob = loadCacheEntry(
+            session->cache, getModuleCacheKey(session, moduleName), session->buildTag, false);
+        if (!blob)
+            return false;
+
+        auto data = static_cast<const uint8_t *>(blob->getBufferPointer());
+        auto end = data + blob->getBufferSize();
+        uint32_t dependencyCount = 0;
+        if (!readCacheString(data, end, outEntry.requestedName) || outEntry.requestedName != moduleName ||
+            !readCacheString(data, end, outEntry.name) || !readCacheString(data, end, outEntry.path) ||
+            !readCacheU32(data, end, dependencyCount))
+            return false;
+
+        for (uint32_t i = 0; i < dependencyCount; i++)
+        {
+            std::string dependency;
+            if (!readCacheString(data, end, dependency))
+                return false;
+            outEntry.dependencies.push_back(std::move(dependency));
+        }
+
+        outEntry.module = new OwnedBlob(std::vector<uint8_t>(data, end));
+        return true;
+    }
+
+    void storeModuleCacheEntry(SlangcSession *session, const std::string &moduleName, IModule *module,
+                               const std::vector<std::string> &dependencies)
+    {
+        const char *path = module->getFilePath();
+        Slang::ComPtr<ISlangBlob> serialized;
+        if (!path || !path[0] || SLANG_FAILED(module->serialize(serialized.writeRef())) || !serialized)
+            return;
+
+        std::vector<uint8_t> payload;
+        appendCacheString(payload, moduleName);
+        appendCacheString(payload, module->getName());
+        appendCacheString(payload, path);
+        appendCacheU32(payload, static_cast<uint32_t>(dependencies.size()));
+        for (const auto &dependency : dependencies)
+            appendCacheString(payload, dependency);
+        auto moduleBytes = static_cast<const uint8_t *>(serialized->getBufferPointer());
+        payload.insert(payload.end(), moduleBytes, moduleBytes + serialized->getBufferSize());
+
+        Slang::ComPtr<ISlangBlob> blob(new OwnedBlob(std::move(payload)));
+        storeCacheEntry(session->cache, getModuleCacheKey(session, moduleName), session->buildTag, blob);
+    }
+
+    bool isModuleLoaded(ISession *session, const std::string &moduleName)
+    {
+        for (SlangInt i = 0; i < session->getLoadedModuleCount(); i++)
+        {
+            const char *name = session->getLoadedModule(i)->getName();
+            if (name && moduleName == name)
+                return true;
+        }
+        return false;
+    }
+
+    // Loads a module from its binary cache entry if the entry is up to date, loading the
+    // modules it imports the same way first so their checking is skipped too. Returns
+    // NULL if the entry is missing or stale, or if the session already holds the module.
+    IModule *loadCachedModule(SlangcSession *session, const std::string &moduleName, Slang::ComPtr<ISlangBlob> &outDiagnostics)
+    {
+        ModuleCacheEntry entry;
+        bool found = loadModuleCacheEntry(session, moduleName, entry);
+        if (found && isModuleLoaded(session->session, entry.name))
+            return nullptr;
+
+        bool upToDate = found && session->session->isBinaryModuleUpToDate(entry.path.c_str(), entry.module);
+
+        IModule *module = nullptr;
+        if (upToDate)
+        {
+            // Imports that miss are simply checked from source when the module is loaded
+            for (const auto &dependency : entry.dependencies)
+            {
+                Slang::ComPtr<ISlangBlob> dependencyDiagnostics;
+                if (!isModuleLoaded(session->session, dependency))
+                    loadCachedModule(session, dependency, dependencyDiagnostics);
+            }
+            module = session->session->loadModuleFromIRBlob(
+                entry.name.c_str(), entry.path.c_str(), entry.module, outDiagnostics.writeRef());
+        }
+
+        std::lock_guard<std::mutex> lock(session->cache->mutex);
+        if (module)
+            session->cache->moduleHitCount++;
+        else
+            session->cache->moduleMissCount++;
+        return module;
+    }
+
+    // Stores a module just checked from source, along with every module the load pulled
+    // into the session. Dependencies are the loaded modules whose files the module uses.
+    void storeLoadedModules(SlangcSession *session, const std::string &moduleName, IModule *module, SlangInt firstNewModule)
+    {
+        std::unordered_set<std::string> dependencyFiles;
+        for (int32_t i = 0; i < module->getDependencyFileCount(); i++)
+            dependencyFiles.insert(module->getDependencyFilePath(i));
+
+        std::vector<std::string> dependencies;
+        ISession *slangSession = session->session;
+        for (SlangInt i = 0; i < slangSession->getLoadedModuleCount(); i++)
+        {
+            IModule *loaded = slangSession->getLoadedModule(i);
+            const char *path = loaded->getFilePath();
+            if (loaded != module && path && dependencyFiles.count(path))
+                dependencies.push_back(loaded->getName());
+        }
+
+        for (SlangInt i = firstNewModule; i < slangSession->getLoadedModuleCount(); i++)
+        {
+            IModule *loaded = slangSession->getLoadedModule(i);
+            if (loaded != module)
+                storeModuleCacheEntry(session, loaded->getName(), loaded, {});
+        }
+        storeModuleCacheEntry(session, moduleName, module, dependencies);
+    }
+}
+
+//
+// Global Session Management
+//
+
+SlangcGlobalSession *slangc_createGlobalSession(void)
+{
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+    clearError();
+
+    auto wrapper = std::make_unique<SlangcGlobalSession>();
+
+    SlangResult result = slang_createGlobalSession(SLANG_API_VERSION, wrapper->session.writeRef());
+    if (SLANG_FAILED(result))
+    {
+        setError("Failed to create global session");
+        return nullptr;
+    }
+
+    return wrapper.release();
+}
+
+SlangcGlobalSession *slangc_createGlobalSessionWithDesc(
+    const SlangcGlobalSessionDesc *desc)
+{
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    clearError();
+    if (!desc)
+    {
+        setError("Invalid session description");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<SlangcGlobalSession>();
+
+    SlangResult result;
+    if (desc->coreModuleSnapshotPath && desc->coreModuleSnapshotPath[0])
+    {
+        result = createGlobalSessionFromSnapshot(desc->apiVersion, desc->coreModuleSnapshotPath, wrapper->session);
+    }
+    else
+    {
+        // Fallback to basic global session creation since slang_createGlobalSession2 may not be available
+        result = slang_createGlobalSession(desc->apiVersion, wrapper->session.writeRef());
+    }
+    if (SLANG_FAILED(result))
+    {
+        setError("Failed to create global session with description");
+        return nullptr;
+    }
+
+    return wrapper.release();
+}
+
+void slangc_releaseGlobalSession(SlangcGlobalSession *globalSession)
+{
+    if (globalSession && globalSession->pool)
+    {
+        setError("Global session is owned by a session pool; return it with slangc_returnGlobalSession");
+        return;
+    }
+    delete globalSession;
+}
+
+SlangcProfileID slangc_findProfile(SlangcGlobalSession *globalSession, const char *name)
+{
+    if (!isSlangAvailable())
+        return 0;
+    if (!globalSession || !name)
+        return 0;
+    return globalSession->session->findProfile(name);
+}
+
+//
+// Session Pool
+//
+
+SlangcSessionPool *slangc_createSessionPool(const SlangcSessionPoolDesc *desc)
+{
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    clearError();
+    auto pool = std::make_unique<SlangcSessionPool>();
+
+    int32_t maxGlobalSessions = desc ? desc->maxGlobalSessions : 0;
+    if (maxGlobalSessions <= 0)
+        maxGlobalSessions = std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+    pool->maxGlobalSessions = maxGlobalSessions;
+
+    // Copy the global session settings so the caller's description does not need to outlive the pool
+    const SlangcGlobalSessionDesc *globalDesc = desc ? desc->globalSessionDesc : nullptr;
+    if (globalDesc)
+    {
+        pool->globalSessionDesc = *globalDesc;
+        for (int32_t i = 0; i < globalDesc->searchPathCount; i++)
+            pool->searchPaths.push_back(globalDesc->searchPaths[i] ? globalDesc->searchPaths[i] : "");
+        if (globalDesc->coreModuleSnapshotPath)
+            pool->coreModuleSnapshotPath = globalDesc->coreModuleSnapshotPath;
+    }
+    for (const auto &path : pool->searchPaths)
+        pool->searchPathPointers.push_back(path.c_str());
+    pool->globalSessionDesc.searchPaths = pool->searchPathPointers.data();
+    pool->globalSessionDesc.searchPathCount = static_cast<int32_t>(pool->searchPathPointers.size());
+    pool->globalSessionDesc.coreModuleSnapshotPath =
+        pool->coreModuleSnapshotPath.empty() ? nullptr : pool->coreModuleSnapshotPath.c_str();
+
+    return pool.release();
+}
+
+void slangc_releaseSessionPool(SlangcSessionPool *pool)
+{
+    delete pool;
+}
+
+SlangcGlobalSession *slangc_acquireGlobalSession(SlangcSessionPool *pool)
+{
+    clearError();
+    if (!pool)
+    {
+        setError("Invalid session pool");
+        return nullptr;
+    }
+
+    std::thread::id self = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    for (;;)
+    {
+        if (!pool->idle.empty())
+        {
+            // Prefer the session this thread used last, so its caches stay warm
+            auto it = std::find_if(pool->idle.begin(), pool->idle.end(), [&](SlangcGlobalSession *globalSession)
+                                   { return globalSession->lastOwner == self; });
+            if (it == pool->idle.end())
+                it = pool->idle.end() - 1;
+
+            SlangcGlobalSession *globalSession = *it;
+            pool->idle.erase(it);
+            globalSession->lastOwner = self;
+            globalSession->checkedOut = true;
+            return globalSession;
+        }
+
+        if (pool->createdCount < pool->maxGlobalSessions)
+        {
+            pool->createdCount++;
+            lock.unlock();
+
+            // Created outside the lock; building the core module is the slow part
+            SlangcGlobalSession *globalSession = slangc_createGlobalSessionWithDesc(&pool->globalSessionDesc);
+
+            lock.lock();
+            if (!globalSession)
+            {
+                pool->createdCount--;
+                pool->sessionReturned.notify_one();
+                return nullptr;
+            }
+
+            globalSession->pool = pool;
+            globalSession->lastOwner = self;
+            globalSession->checkedOut = true;
+            pool->sessions.emplace_back(globalSession);
+            return globalSession;
+        }
+
+        pool->sessionReturned.wait(lock);
+    }
+}
+
+SlangcResult slangc_returnGlobalSession(SlangcSessionPool *pool, SlangcGlobalSession *globalSession)
+{
+    if (!pool || !globalSession || globalSession->pool != pool)
+    {
+        setError("Invalid session pool or global session");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    {
+        // A second return would let two threads check out the same global session
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if (!globalSession->checkedOut)
+        {
+            setError("Global session is not checked out of its pool");
+            return SLANGC_E_INVALID_ARG;
+        }
+        globalSession->checkedOut = false;
+        pool->idle.push_back(globalSession);
+    }
+    // Wake everyone: some waiters only accept one particular session
+    pool->sessionReturned.notify_all();
+    return SLANGC_OK;
+}
+
+// Waits until a specific global session is idle and checks it out of its pool
+void acquireSpecificGlobalSession(SlangcSessionPool *pool, SlangcGlobalSession *globalSession)
+{
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    for (;;)
+    {
+        auto it = std::find(pool->idle.begin(), pool->idle.end(), globalSession);
+        if (it != pool->idle.end())
+        {
+            pool->idle.erase(it);
+            globalSession->lastOwner = std::this_thread::get_id();
+            globalSession->checkedOut = true;
+            return;
+        }
+        pool->sessionReturned.wait(lock);
+    }
+}
+
+//
+// Session Management
+//
+
+SlangcSession *slangc_createSession(
+    SlangcGlobalSession *globalSession,
+    const SlangcSessionDesc *desc)
+{
+
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    clearError();
+    if (!globalSession)
+    {
+        setError("Invalid global session");
+        return nullptr;
+    }
+
+    return createSessionFromDesc(globalSession, desc, SLANG_PROFILE_UNKNOWN);
+}
 
 SlangcSession *slangc_createSessionWithProfile(
     SlangcGlobalSession *globalSession,
@@ -369,312 +2629,4694 @@ SlangcSession *slangc_createSessionWithProfile(
     const SlangcSessionDesc *desc)
 {
     clearError();
-    if (!isSlangAvailable())
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!globalSession)
+    {
+        setError("Invalid global session");
+        return nullptr;
+    }
+
+    SlangcSession *session = createSessionFromDesc(globalSession, desc, (SlangProfileID)profile);
+    if (!session)
+        setError("Failed to create session with profile");
+    return session;
+}
+
+SlangcSession *slangc_findOrCreateSession(
+    SlangcGlobalSession *globalSession,
+    const SlangcSessionDesc *desc)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!globalSession)
+    {
+        setError("Invalid global session");
+        return nullptr;
+    }
+
+    std::string key = makeSessionKey(desc);
+    auto it = globalSession->sharedSessions.find(key);
+    if (it != globalSession->sharedSessions.end())
+    {
+        it->second->sharedRefCount++;
+        return it->second;
+    }
+
+    SlangcSession *session = createSessionFromDesc(globalSession, desc, SLANG_PROFILE_UNKNOWN);
+    if (!session)
+        return nullptr;
+
+    session->sharedOwner = globalSession;
+    session->sharedKey = key;
+    session->sharedRefCount = 1;
+    globalSession->sharedSessions[key] = session;
+    return session;
+}
+
+uint64_t slangc_getSessionMacroFingerprint(SlangcSession *session)
+{
+    return session ? session->macroFingerprint : 0;
+}
+
+void slangc_releaseSession(SlangcSession *session)
+{
+    if (session && session->sharedOwner)
+    {
+        if (--session->sharedRefCount > 0)
+            return;
+        session->sharedOwner->sharedSessions.erase(session->sharedKey);
+    }
+    delete session;
+}
+
+//
+// Compiled-Code Cache
+//
+
+SlangcCache *slangc_createCache(const SlangcCacheDesc *desc)
+{
+    clearError();
+    if (!desc || !desc->directory || !desc->directory[0])
+    {
+        setError("Invalid cache description");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<SlangcCache>();
+    wrapper->directory = desc->directory;
+    wrapper->maxSizeBytes = desc->maxSizeBytes;
+    wrapper->cacheModules = desc->cacheModules;
+
+    std::error_code ec;
+    std::filesystem::create_directories(wrapper->directory, ec);
+    if (ec || !std::filesystem::is_directory(wrapper->directory, ec))
+    {
+        setError("Failed to create cache directory");
+        return nullptr;
+    }
+
+    scanCacheDirectory(wrapper.get());
+    evictCacheEntriesLocked(wrapper.get());
+
+    return wrapper.release();
+}
+
+void slangc_releaseCache(SlangcCache *cache)
+{
+    delete cache;
+}
+
+SlangcResult slangc_getCacheStats(SlangcCache *cache, SlangcCacheStats *outStats)
+{
+    if (!cache || !outStats)
+        return SLANGC_E_INVALID_ARG;
+
+    std::lock_guard<std::mutex> lock(cache->mutex);
+    outStats->hitCount = cache->hitCount;
+    outStats->missCount = cache->missCount;
+    outStats->moduleHitCount = cache->moduleHitCount;
+    outStats->moduleMissCount = cache->moduleMissCount;
+    outStats->evictionCount = cache->evictionCount;
+    outStats->entryCount = cache->entries.size();
+    outStats->totalSizeBytes = cache->totalSizeBytes;
+    return SLANGC_OK;
+}
+
+//
+// File System
+//
+
+SlangcFileSystem *slangc_createFileSystem(const SlangcFileSystemDesc *desc)
+{
+    clearError();
+    bool hasArchive = desc && desc->archivePath && desc->archivePath[0];
+    bool allowOSFiles = !desc || !desc->disableOSFiles;
+    if (!hasArchive && !allowOSFiles)
+    {
+        setError("File system needs an archive when OS files are disabled");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<SlangcFileSystem>();
+    wrapper->fileSystem = new MappedFileSystem(allowOSFiles);
+    if (hasArchive && !wrapper->fileSystem->openArchive(desc->archivePath))
+    {
+        setError(std::string("Failed to open file system archive: ") + desc->archivePath);
+        return nullptr;
+    }
+
+    // Modules checked against one archive must not be reused with another
+    wrapper->cacheScope = allowOSFiles ? "os" : "archive-only";
+    if (const MappedFile *archive = wrapper->fileSystem->getArchive())
+    {
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(hashBytes(archive->data(), archive->size())));
+        wrapper->cacheScope += std::string(",archive:") + hash;
+    }
+
+    return wrapper.release();
+}
+
+void slangc_releaseFileSystem(SlangcFileSystem *fileSystem)
+{
+    delete fileSystem;
+}
+
+void slangc_clearFileSystemCache(SlangcFileSystem *fileSystem)
+{
+    if (fileSystem)
+        fileSystem->fileSystem->clearCache();
+}
+
+SlangcResult slangc_writeFileSystemArchive(
+    const char *archivePath,
+    const char **filePaths,
+    int32_t fileCount)
+{
+    clearError();
+    if (!archivePath || (!filePaths && fileCount > 0) || fileCount < 0)
+    {
+        setError("Invalid parameters for file system archive");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    std::vector<std::string> paths;
+    std::vector<std::vector<uint8_t>> contents;
+    for (int32_t i = 0; i < fileCount; i++)
+    {
+        if (!filePaths[i])
+        {
+            setError("Invalid file path at index " + std::to_string(i));
+            return SLANGC_E_INVALID_ARG;
+        }
+
+        std::ifstream file(filePaths[i], std::ios::binary);
+        if (!file)
+        {
+            setError(std::string("Failed to read file: ") + filePaths[i]);
+            return SLANGC_FAIL;
+        }
+        paths.push_back(MappedFileSystem::normalizePath(filePaths[i]));
+        contents.emplace_back(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::vector<uint8_t> archive;
+    auto append = [&](const void *data, size_t size)
+    {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        archive.insert(archive.end(), bytes, bytes + size);
+    };
+
+    uint32_t entryCount = static_cast<uint32_t>(paths.size());
+    uint64_t offset = sizeof(kFileSystemArchiveMagic) + sizeof(kFileSystemArchiveFormatVersion) + sizeof(entryCount);
+    for (const auto &path : paths)
+        offset += sizeof(uint32_t) + 2 * sizeof(uint64_t) + path.size();
+
+    append(kFileSystemArchiveMagic, sizeof(kFileSystemArchiveMagic));
+    append(&kFileSystemArchiveFormatVersion, sizeof(kFileSystemArchiveFormatVersion));
+    append(&entryCount, sizeof(entryCount));
+    for (size_t i = 0; i < paths.size(); i++)
+    {
+        uint32_t pathLength = static_cast<uint32_t>(paths[i].size());
+        uint64_t size = contents[i].size();
+        append(&pathLength, sizeof(pathLength));
+        append(&offset, sizeof(offset));
+        append(&size, sizeof(size));
+        append(paths[i].data(), paths[i].size());
+        offset += size;
+    }
+    for (const auto &content : contents)
+        append(content.data(), content.size());
+
+    // Replaced rather than rewritten, since running services may still map the old archive
+    bool written = replaceFile(archivePath, [&](std::ofstream &file)
+                               { file.write(reinterpret_cast<const char *>(archive.data()), static_cast<std::streamsize>(archive.size())); });
+    if (!written)
+    {
+        setError(std::string("Failed to write file system archive: ") + archivePath);
+        return SLANGC_FAIL;
+    }
+    return SLANGC_OK;
+}
+
+//
+// Compile Profiling
+//
+
+SlangcProfile *slangc_createProfile(void)
+{
+    clearError();
+    return new SlangcProfile();
+}
+
+void slangc_releaseProfile(SlangcProfile *profile)
+{
+    delete profile;
+}
+
+void slangc_resetProfile(SlangcProfile *profile)
+{
+    if (!profile)
+        return;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    for (auto &stats : profile->phases)
+        stats = {};
+    profile->benchmarkEntries.clear();
+    profile->benchmarkIndices.clear();
+}
+
+SlangcResult slangc_getProfilePhaseStats(
+    SlangcProfile *profile,
+    SlangcProfilePhase phase,
+    SlangcProfilePhaseStats *outStats)
+{
+    if (!profile || !outStats || phase < 0 || phase >= SLANGC_PROFILE_PHASE_COUNT)
+        return SLANGC_E_INVALID_ARG;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    *outStats = profile->phases[phase];
+    return SLANGC_OK;
+}
+
+int32_t slangc_getProfileBenchmarkEntryCount(SlangcProfile *profile)
+{
+    if (!profile)
+        return 0;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    return static_cast<int32_t>(profile->benchmarkEntries.size());
+}
+
+SlangcResult slangc_getProfileBenchmarkEntry(
+    SlangcProfile *profile,
+    int32_t index,
+    SlangcProfileBenchmarkEntry *outEntry)
+{
+    if (!profile || !outEntry)
+        return SLANGC_E_INVALID_ARG;
+
+    std::lock_guard<std::mutex> lock(profile->mutex);
+    if (index < 0 || static_cast<size_t>(index) >= profile->benchmarkEntries.size())
+        return SLANGC_E_INVALID_ARG;
+
+    const auto &entry = profile->benchmarkEntries[index];
+    outEntry->name = entry.name.c_str();
+    outEntry->invocationCount = entry.invocationCount;
+    outEntry->milliseconds = entry.milliseconds;
+    return SLANGC_OK;
+}
+
+//
+// Tracing
+//
+
+SlangcResult slangc_beginTrace(uint32_t eventsPerThread)
+{
+    clearError();
+    TraceRegistry &registry = getTraceRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (g_traceEnabled)
+    {
+        setError("A trace is already running");
+        return SLANGC_FAIL;
+    }
+
+    registry.buffers.clear();
+    registry.eventsPerThread = eventsPerThread > 0 ? eventsPerThread : kDefaultTraceEventsPerThread;
+    registry.startTime = std::chrono::steady_clock::now();
+    registry.generation++;
+    g_traceEnabled = true;
+    return SLANGC_OK;
+}
+
+SlangcResult slangc_endTrace(const char *outputPath)
+{
+    clearError();
+    TraceRegistry &registry = getTraceRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (!g_traceEnabled)
+    {
+        setError("No trace is running");
+        return SLANGC_FAIL;
+    }
+
+    // Threads check the flag after raising their writing flag, so once every flag is
+    // seen clear no thread can write again
+    g_traceEnabled = false;
+    for (const auto &buffer : registry.buffers)
+    {
+        while (buffer->writing.load())
+            std::this_thread::yield();
+    }
+
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    buffers.swap(registry.buffers);
+    if (!outputPath)
+        return SLANGC_OK;
+
+    std::string json = "{\"traceEvents\":[";
+    bool first = true;
+    uint64_t droppedEvents = 0;
+    for (const auto &buffer : buffers)
+    {
+        json += first ? "\n" : ",\n";
+        first = false;
+        json += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + std::to_string(buffer->threadId) +
+                ",\"args\":{\"name\":\"slangc thread " + std::to_string(buffer->osThreadId) + "\"}}";
+
+        uint64_t count = buffer->writeCount.load(std::memory_order_acquire);
+        uint64_t begin = count > buffer->capacity ? count - buffer->capacity : 0;
+        droppedEvents += begin;
+        for (uint64_t i = begin; i < count; i++)
+        {
+            const TraceEvent &event = buffer->events[i % buffer->capacity];
+            json += ",\n{\"name\":";
+            appendJsonString(json, event.name);
+            json += ",\"cat\":\"slangc\",\"ph\":\"X\",\"ts\":" + std::to_string(event.startMicroseconds) +
+                    ",\"dur\":" + std::to_string(event.durationMicroseconds) +
+                    ",\"pid\":1,\"tid\":" + std::to_string(buffer->threadId) + ",\"args\":{\"module\":";
+            appendJsonString(json, event.moduleName);
+            json += ",\"entryPoint\":";
+            appendJsonString(json, event.entryPointName);
+            if (event.target >= 0)
+            {
+                json += ",\"target\":";
+                appendJsonString(json, getCompileTargetName(event.target));
+            }
+            json += "}}";
+        }
+    }
+    json += "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" + std::to_string(droppedEvents) + "}}\n";
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file)
+    {
+        setError(std::string("Failed to write trace file: ") + outputPath);
+        return SLANGC_FAIL;
+    }
+    return SLANGC_OK;
+}
+
+//
+// Module Loading
+//
+
+SlangcModule *slangc_loadModule(
+    SlangcSession *session,
+    const char *moduleName,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!session || !moduleName)
+    {
+        setError("Invalid session or module name");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<SlangcModule>();
+    wrapper->session = session;
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_LOAD_MODULE);
+    TraceScope traceScope("loadModule");
+    traceScope.setModuleName(moduleName);
+
+    bool cacheModules = session->cache && !session->moduleCacheScope.empty();
+    SlangInt loadedModuleCount = session->session->getLoadedModuleCount();
+    if (cacheModules)
+        wrapper->module = loadCachedModule(session, moduleName, diagnostics);
+
+    if (!wrapper->module)
+    {
+        wrapper->module = session->session->loadModule(moduleName, diagnostics.writeRef());
+        if (cacheModules && wrapper->module && session->session->getLoadedModuleCount() > loadedModuleCount)
+            storeLoadedModules(session, moduleName, wrapper->module, loadedModuleCount);
+    }
+    profileScope.captureReports(diagnostics);
+    if (!wrapper->module)
+    {
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError("Failed to load module");
+        return nullptr;
+    }
+
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    return wrapper.release();
+}
+
+SlangcModule *slangc_loadModuleFromSource(
+    SlangcSession *session,
+    const char *moduleName,
+    const char *path,
+    const char *sourceText,
+    size_t sourceSize,
+    SlangcBlob **outDiagnostics)
+{
+    return slangc_loadModuleFromSourceBuffer(
+        session, moduleName, path, sourceText, sourceSize, false, outDiagnostics);
+}
+
+SlangcModule *slangc_loadModuleFromSourceBuffer(
+    SlangcSession *session,
+    const char *moduleName,
+    const char *path,
+    const char *sourceText,
+    size_t sourceSize,
+    bool takeOwnership,
+    SlangcBlob **outDiagnostics)
+{
+    // Wrap the buffer first so an owned buffer is freed on every failure path
+    Slang::ComPtr<ISlangBlob> sourceBlob;
+    if (sourceText)
+    {
+        sourceBlob = new ExternalBlob(
+            sourceText,
+            sourceSize == 0 ? strlen(sourceText) : sourceSize,
+            takeOwnership);
+    }
+
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    clearError();
+    if (!session || !moduleName || !sourceBlob)
+    {
+        setError("Invalid session, module name, or source text");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<SlangcModule>();
+    wrapper->session = session;
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_LOAD_MODULE);
+    TraceScope traceScope("loadModule");
+    traceScope.setModuleName(moduleName);
+
+    wrapper->module = session->session->loadModuleFromSource(
+        moduleName, path, sourceBlob, diagnostics.writeRef());
+    profileScope.captureReports(diagnostics);
+
+    if (!wrapper->module)
+    {
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError("Failed to load module from source");
+        return nullptr;
+    }
+
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    return wrapper.release();
+}
+
+void slangc_releaseModule(SlangcModule *module)
+{
+    delete module;
+}
+
+//
+// Component Type Management
+//
+
+SlangcComponentTypeKind slangc_getComponentTypeKind(SlangcComponentType *componentType)
+{
+    if (!componentType)
+    {
+        return SLANGC_COMPONENT_TYPE_MODULE; // Default fallback
+    }
+    return componentType->kind;
+}
+
+SlangcModule *slangc_getComponentTypeModule(SlangcComponentType *componentType)
+{
+    if (!componentType || componentType->kind != SLANGC_COMPONENT_TYPE_MODULE)
+    {
+        return nullptr;
+    }
+    return componentType->module;
+}
+
+SlangcEntryPoint *slangc_getComponentTypeEntryPoint(SlangcComponentType *componentType)
+{
+    if (!componentType || componentType->kind != SLANGC_COMPONENT_TYPE_ENTRY_POINT)
+    {
+        return nullptr;
+    }
+    return componentType->entryPoint;
+}
+
+SlangcTypeConformance *slangc_getComponentTypeTypeConformance(SlangcComponentType *componentType)
+{
+    if (!componentType || componentType->kind != SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE)
+    {
+        return nullptr;
+    }
+    return componentType->typeConformance;
+}
+
+SlangcEntryPoint *slangc_findEntryPoint(
+    SlangcModule *module,
+    const char *entryPointName,
+    SlangcStage stage,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!module || !entryPointName)
+    {
+        setError("Invalid module or entry point name");
+        return nullptr;
+    }
+
+    auto wrapper = std::make_unique<SlangcEntryPoint>();
+    wrapper->module = module->module;
+    wrapper->session = module->session;
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    ProfileScope profileScope(module->session, SLANGC_PROFILE_PHASE_FIND_ENTRY_POINT);
+    TraceScope traceScope("findEntryPoint");
+    if (traceScope.isActive())
+        traceScope.setModuleName(module->module->getName());
+    traceScope.setEntryPointName(entryPointName);
+
+    SlangResult result = module->module->findAndCheckEntryPoint(
+        entryPointName,
+        convertStage(stage),
+        wrapper->entryPoint.writeRef(),
+        diagnostics.writeRef());
+    profileScope.captureReports(diagnostics);
+
+    if (SLANG_FAILED(result))
+    {
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError("Failed to find entry point");
+        return nullptr;
+    }
+
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    return wrapper.release();
+}
+
+void slangc_releaseEntryPoint(SlangcEntryPoint *entryPoint)
+{
+    delete entryPoint;
+}
+
+namespace
+{
+    std::string trimTypeName(const std::string &name)
+    {
+        size_t begin = name.find_first_not_of(" \t\r\n");
+        if (begin == std::string::npos)
+            return std::string();
+        size_t end = name.find_last_not_of(" \t\r\n");
+        return name.substr(begin, end - begin + 1);
+    }
+
+    // Resolves a type name against a component's layout. Names the layout cannot find
+    // directly that have the form "Generic<A, B>" are specialized argument by argument.
+    TypeReflection *resolveTypeName(
+        ISession *session,
+        ProgramLayout *layout,
+        const std::string &name,
+        Slang::ComPtr<ISlangBlob> &diagnostics)
+    {
+        if (TypeReflection *type = layout->findTypeByName(name.c_str()))
+            return type;
+
+        size_t open = name.find('<');
+        if (open == std::string::npos || name.back() != '>')
+            return nullptr;
+
+        TypeReflection *genericType = layout->findTypeByName(trimTypeName(name.substr(0, open)).c_str());
+        if (!genericType)
+            return nullptr;
+
+        // Split the arguments on top-level commas
+        std::vector<SpecializationArg> args;
+        int depth = 0;
+        size_t argBegin = open + 1;
+        for (size_t i = argBegin; i < name.size(); i++)
+        {
+            char c = name[i];
+            if (c == '<')
+                depth++;
+            else if (c == '>' && depth > 0)
+                depth--;
+            else if ((c == ',' && depth == 0) || i == name.size() - 1)
+            {
+                TypeReflection *argType = resolveTypeName(
+                    session, layout, trimTypeName(name.substr(argBegin, i - argBegin)), diagnostics);
+                if (!argType)
+                    return nullptr;
+                args.push_back(SpecializationArg::fromType(argType));
+                argBegin = i + 1;
+            }
+        }
+
+        return session->specializeType(
+            genericType, args.data(), static_cast<SlangInt>(args.size()), diagnostics.writeRef());
+    }
+}
+
+SlangcTypeConformance *slangc_createTypeConformance(
+    SlangcModule *module,
+    const char *typeName,
+    const char *interfaceName,
+    int32_t conformanceId,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!module || !module->session || !typeName || !interfaceName)
+    {
+        setError("Invalid parameters for type conformance");
+        return nullptr;
+    }
+
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    ProgramLayout *layout = module->module->getLayout(0, diagnostics.writeRef());
+    if (!layout)
+    {
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError("Failed to get module layout for type conformance");
+        return nullptr;
+    }
+
+    ISession *session = module->session->session;
+    TypeReflection *type = resolveTypeName(session, layout, trimTypeName(typeName), diagnostics);
+    TypeReflection *interfaceType =
+        type ? resolveTypeName(session, layout, trimTypeName(interfaceName), diagnostics) : nullptr;
+    if (!type || !interfaceType)
+    {
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError(std::string("Failed to resolve type: ") + (type ? interfaceName : typeName));
+        return nullptr;
+    }
+
+    auto conformance = std::make_unique<SlangcTypeConformance>();
+    conformance->session = module->session;
+    SlangResult result = session->createTypeConformanceComponentType(
+        type,
+        interfaceType,
+        conformance->conformance.writeRef(),
+        conformanceId,
+        diagnostics.writeRef());
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+
+    if (SLANG_FAILED(result) || !conformance->conformance)
+    {
+        setError(std::string("Type ") + typeName + " does not conform to " + interfaceName);
+        return nullptr;
+    }
+
+    return conformance.release();
+}
+
+void slangc_releaseTypeConformance(SlangcTypeConformance *typeConformance)
+{
+    delete typeConformance;
+}
+
+SlangcComponentType *slangc_createModuleComponentType(SlangcModule *module)
+{
+    clearError();
+    if (!module)
+    {
+        setError("Invalid module");
+        return nullptr;
+    }
+
+    auto wrapper = new SlangcComponentType();
+    wrapper->kind = SLANGC_COMPONENT_TYPE_MODULE;
+    wrapper->module = module;
+    return wrapper;
+}
+
+SlangcComponentType *slangc_createEntryPointComponentType(SlangcEntryPoint *entryPoint)
+{
+    clearError();
+    if (!entryPoint)
+    {
+        setError("Invalid entry point");
+        return nullptr;
+    }
+
+    auto wrapper = new SlangcComponentType();
+    wrapper->kind = SLANGC_COMPONENT_TYPE_ENTRY_POINT;
+    wrapper->entryPoint = entryPoint;
+    return wrapper;
+}
+
+SlangcComponentType *slangc_createTypeConformanceComponentType(SlangcTypeConformance *typeConformance)
+{
+    clearError();
+    if (!typeConformance)
+    {
+        setError("Invalid type conformance");
+        return nullptr;
+    }
+
+    auto wrapper = new SlangcComponentType();
+    wrapper->kind = SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE;
+    wrapper->typeConformance = typeConformance;
+    return wrapper;
+}
+
+SlangcComponentType *slangc_createCompositeComponentType(
+    SlangcSession *session,
+    const SlangcComponentType *componentTypes,
+    int32_t componentTypeCount,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!session || !componentTypes || componentTypeCount <= 0)
+    {
+        setError("Invalid parameters for composite component type");
+        return nullptr;
+    }
+
+    auto compositeWrapper = new SlangcComposite();
+    compositeWrapper->session = session;
+    collectComponentModules(componentTypes, componentTypeCount, compositeWrapper->modules);
+    Slang::ComPtr<ISlangBlob> diagnostics;
+
+    std::vector<IComponentType *> slangComponents(componentTypeCount);
+    for (int32_t i = 0; i < componentTypeCount; i++)
+    {
+        slangComponents[i] = getComponentType(&componentTypes[i]);
+        if (!slangComponents[i])
+        {
+            delete compositeWrapper;
+            setError("Invalid component type in array");
+            return nullptr;
+        }
+    }
+
+    ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_CREATE_COMPOSITE);
+    TraceScope traceScope("createComposite");
+    if (traceScope.isActive())
+    {
+        collectTraceNames(componentTypes, componentTypeCount,
+                          compositeWrapper->traceModuleNames, compositeWrapper->traceEntryPointNames);
+        traceScope.setModuleName(compositeWrapper->traceModuleNames.c_str());
+        if (!compositeWrapper->traceEntryPointNames.empty())
+            traceScope.setEntryPointName(compositeWrapper->traceEntryPointNames[0].c_str());
+    }
+
+    SlangResult result = session->session->createCompositeComponentType(
+        slangComponents.data(),
+        componentTypeCount,
+        compositeWrapper->composite.writeRef(),
+        diagnostics.writeRef());
+    profileScope.captureReports(diagnostics);
+
+    if (SLANG_FAILED(result))
+    {
+        delete compositeWrapper;
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError("Failed to create composite component type");
+        return nullptr;
+    }
+
+    auto wrapper = new SlangcComponentType();
+    wrapper->kind = SLANGC_COMPONENT_TYPE_COMPOSITE;
+    wrapper->composite = compositeWrapper;
+
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    return wrapper;
+}
+
+SlangcComponentType *slangc_linkComponentType(
+    SlangcComponentType *componentType,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!componentType)
+    {
+        setError("Invalid component type");
+        return nullptr;
+    }
+
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!slangComponentType)
+    {
+        setError("Invalid component type");
+        return nullptr;
+    }
+
+    auto linkedCompositeWrapper = new SlangcComposite();
+    linkedCompositeWrapper->session = getOwningSession(componentType);
+    collectComponentModules(componentType, 1, linkedCompositeWrapper->modules);
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    ProfileScope profileScope(linkedCompositeWrapper->session, SLANGC_PROFILE_PHASE_LINK);
+    TraceScope traceScope("link");
+    if (traceScope.isActive())
+    {
+        collectTraceNames(componentType, 1,
+                          linkedCompositeWrapper->traceModuleNames, linkedCompositeWrapper->traceEntryPointNames);
+        traceScope.setModuleName(linkedCompositeWrapper->traceModuleNames.c_str());
+        if (!linkedCompositeWrapper->traceEntryPointNames.empty())
+            traceScope.setEntryPointName(linkedCompositeWrapper->traceEntryPointNames[0].c_str());
+    }
+
+    SlangResult result = slangComponentType->link(
+        linkedCompositeWrapper->composite.writeRef(),
+        diagnostics.writeRef());
+    profileScope.captureReports(diagnostics);
+
+    if (SLANG_FAILED(result))
+    {
+        delete linkedCompositeWrapper;
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+        setError("Failed to link component type");
+        return nullptr;
+    }
+
+    auto wrapper = new SlangcComponentType();
+    wrapper->kind = SLANGC_COMPONENT_TYPE_COMPOSITE;
+    wrapper->composite = linkedCompositeWrapper;
+
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    return wrapper;
+}
+
+void slangc_releaseComponentType(SlangcComponentType *componentType)
+{
+    if (!componentType)
+        return;
+
+    // Clean up composite wrapper if it exists
+    if (componentType->kind == SLANGC_COMPONENT_TYPE_COMPOSITE && componentType->composite)
+    {
+        delete static_cast<SlangcComposite *>(componentType->composite);
+    }
+
+    delete componentType;
+}
+
+SlangcComponentType *slangc_specialize(
+    SlangcComponentType *componentType,
+    const char **typeArgumentNames,
+    int32_t typeArgumentCount,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    IComponentType *slangComponentType = getComponentType(componentType);
+    SlangcSession *session = getOwningSession(componentType);
+    if (!slangComponentType || !session || typeArgumentCount < 0 || (typeArgumentCount > 0 && !typeArgumentNames))
+    {
+        setError("Invalid parameters for specialization");
+        return nullptr;
+    }
+
+    char pointerKey[32];
+    std::snprintf(pointerKey, sizeof(pointerKey), "%p", static_cast<void *>(slangComponentType));
+    std::string key = pointerKey;
+    for (int32_t i = 0; i < typeArgumentCount; i++)
+    {
+        if (!typeArgumentNames[i])
+        {
+            setError("Invalid type argument at index " + std::to_string(i));
+            return nullptr;
+        }
+        key.push_back('\0');
+        key.append(typeArgumentNames[i]);
+    }
+
+    auto compositeWrapper = std::make_unique<SlangcComposite>();
+    compositeWrapper->session = session;
+    collectComponentModules(componentType, 1, compositeWrapper->modules);
+
+    {
+        std::lock_guard<std::mutex> lock(session->specializationMutex);
+        auto found = session->specializations.find(key);
+        if (found != session->specializations.end())
+            compositeWrapper->composite = found->second.specialized;
+    }
+
+    if (!compositeWrapper->composite)
+    {
+        Slang::ComPtr<ISlangBlob> diagnostics;
+        ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_SPECIALIZE);
+        TraceScope traceScope("specialize");
+        if (traceScope.isActive())
+        {
+            collectTraceNames(componentType, 1,
+                              compositeWrapper->traceModuleNames, compositeWrapper->traceEntryPointNames);
+            traceScope.setModuleName(compositeWrapper->traceModuleNames.c_str());
+            if (!compositeWrapper->traceEntryPointNames.empty())
+                traceScope.setEntryPointName(compositeWrapper->traceEntryPointNames[0].c_str());
+        }
+
+        ProgramLayout *layout = slangComponentType->getLayout(0, diagnostics.writeRef());
+        if (!layout)
+        {
+            setDiagnosticsOutput(outDiagnostics, diagnostics);
+            setError("Failed to get layout for specialization");
+            return nullptr;
+        }
+
+        std::vector<SpecializationArg> args(typeArgumentCount);
+        for (int32_t i = 0; i < typeArgumentCount; i++)
+        {
+            TypeReflection *type = resolveTypeName(
+                session->session, layout, trimTypeName(typeArgumentNames[i]), diagnostics);
+            if (!type)
+            {
+                setDiagnosticsOutput(outDiagnostics, diagnostics);
+                setError(std::string("Failed to resolve specialization type: ") + typeArgumentNames[i]);
+                return nullptr;
+            }
+            args[i] = SpecializationArg::fromType(type);
+        }
+
+        SlangResult result = slangComponentType->specialize(
+            args.data(),
+            typeArgumentCount,
+            compositeWrapper->composite.writeRef(),
+            diagnostics.writeRef());
+        profileScope.captureReports(diagnostics);
+        setDiagnosticsOutput(outDiagnostics, diagnostics);
+
+        if (SLANG_FAILED(result) || !compositeWrapper->composite)
+        {
+            setError("Failed to specialize component type");
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(session->specializationMutex);
+        session->specializations[key] = {Slang::ComPtr<IComponentType>(slangComponentType), compositeWrapper->composite};
+    }
+
+    auto wrapper = new SlangcComponentType();
+    wrapper->kind = SLANGC_COMPONENT_TYPE_COMPOSITE;
+    wrapper->composite = compositeWrapper.release();
+    return wrapper;
+}
+
+SlangcBlob *slangc_getEntryPointCode(
+    SlangcComponentType *componentType,
+    int32_t entryPointIndex,
+    int32_t targetIndex,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    if (!componentType)
+    {
+        setError("Invalid component type");
+        return nullptr;
+    }
+
+    Slang::ComPtr<ISlangBlob> codeBlob;
+    Slang::ComPtr<ISlangBlob> diagnostics;
+
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!slangComponentType)
+    {
+        setError("Invalid component type");
+        return nullptr;
+    }
+
+    SlangcSession *session = getOwningSession(componentType);
+    SlangcCache *cache = session ? session->cache : nullptr;
+    ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_GET_ENTRY_POINT_CODE);
+    TraceScope traceScope("codegen");
+    if (traceScope.isActive())
+    {
+        std::string moduleNames;
+        std::vector<std::string> entryPointNames;
+        collectTraceNames(componentType, 1, moduleNames, entryPointNames);
+        traceScope.setModuleName(moduleNames.c_str());
+        if (entryPointIndex >= 0 && static_cast<size_t>(entryPointIndex) < entryPointNames.size())
+            traceScope.setEntryPointName(entryPointNames[entryPointIndex].c_str());
+        if (session && targetIndex >= 0 && static_cast<size_t>(targetIndex) < session->targets.size())
+            traceScope.setTarget(session->targets[targetIndex]);
+    }
+    std::string cacheKey;
+    if (cache)
+    {
+        Slang::ComPtr<ISlangBlob> hash;
+        slangComponentType->getEntryPointHash(entryPointIndex, targetIndex, hash.writeRef());
+        cacheKey = hashToHex(hash);
+        if (!cacheKey.empty())
+            codeBlob = loadCacheEntry(cache, cacheKey, session->buildTag);
+    }
+
+    if (!codeBlob)
+    {
+        SlangResult result = slangComponentType->getEntryPointCode(
+            entryPointIndex,
+            targetIndex,
+            codeBlob.writeRef(),
+            diagnostics.writeRef());
+        profileScope.captureReports(diagnostics);
+
+        if (SLANG_FAILED(result))
+        {
+            setDiagnosticsOutput(outDiagnostics, diagnostics);
+            setError("Failed to get entry point code");
+            return nullptr;
+        }
+
+        if (codeBlob && !cacheKey.empty())
+            storeCacheEntry(cache, cacheKey, session->buildTag, codeBlob);
+    }
+
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+
+    if (codeBlob)
+    {
+        auto codeWrapper = std::make_unique<SlangcBlob>();
+        codeWrapper->blob = codeBlob;
+        return codeWrapper.release();
+    }
+
+    return nullptr;
+}
+
+SlangcBlob *slangc_getTargetCode(
+    SlangcComponentType *componentType,
+    int32_t targetIndex,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!slangComponentType)
+    {
+        setError("Invalid component type");
+        return nullptr;
+    }
+
+    SlangcSession *session = getOwningSession(componentType);
+    ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_GET_TARGET_CODE);
+    TraceScope traceScope("codegen");
+    if (traceScope.isActive())
+    {
+        std::string moduleNames;
+        std::vector<std::string> entryPointNames;
+        collectTraceNames(componentType, 1, moduleNames, entryPointNames);
+        traceScope.setModuleName(moduleNames.c_str());
+        traceScope.setEntryPointName("*");
+        if (session && targetIndex >= 0 && static_cast<size_t>(targetIndex) < session->targets.size())
+            traceScope.setTarget(session->targets[targetIndex]);
+    }
+
+    Slang::ComPtr<ISlangBlob> codeBlob;
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    SlangResult result = slangComponentType->getTargetCode(targetIndex, codeBlob.writeRef(), diagnostics.writeRef());
+    profileScope.captureReports(diagnostics);
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+
+    if (SLANG_FAILED(result) || !codeBlob)
+    {
+        setError("Failed to get target code");
+        return nullptr;
+    }
+
+    auto codeWrapper = std::make_unique<SlangcBlob>();
+    codeWrapper->blob = codeBlob;
+    return codeWrapper.release();
+}
+
+//
+// Reflection
+//
+
+namespace
+{
+    uint32_t toSnapshotSize(size_t size)
+    {
+        if (size == SLANG_UNBOUNDED_SIZE)
+            return 0;
+        return size > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(size);
+    }
+
+    // Accumulates reflection data as separate arrays, then lays them out in one buffer
+    class ReflectionSnapshotBuilder
+    {
+    public:
+        void addEntryPoint(EntryPointReflection *entryPoint)
+        {
+            m_entryPointNames.push_back(addString(entryPoint->getName()));
+            m_entryPointStages.push_back(static_cast<uint32_t>(entryPoint->getStage()));
+            SlangUInt threadGroupSize[3] = {};
+            entryPoint->getComputeThreadGroupSize(3, threadGroupSize);
+            for (SlangUInt size : threadGroupSize)
+                m_entryPointThreadGroupSizes.push_back(static_cast<uint32_t>(size));
+        }
+
+        void addParameter(VariableLayoutReflection *parameter, int32_t entryPointIndex)
+        {
+            TypeLayoutReflection *typeLayout = parameter->getTypeLayout();
+            SlangParameterCategory category = static_cast<SlangParameterCategory>(parameter->getCategory());
+            SlangParameterCategory slotCategory = category == SLANG_PARAMETER_CATEGORY_MIXED
+                                                      ? static_cast<SlangParameterCategory>(typeLayout->getCategoryByIndex(0))
+                                                      : category;
+
+            uint32_t parameterIndex = static_cast<uint32_t>(m_parameterNames.size());
+            m_parameterNames.push_back(addString(parameter->getName()));
+            m_parameterTypeNames.push_back(addString(typeLayout->getName()));
+            m_parameterTypeKinds.push_back(static_cast<uint32_t>(typeLayout->getKind()));
+            m_parameterCategories.push_back(static_cast<uint32_t>(category));
+            m_parameterEntryPoints.push_back(static_cast<uint32_t>(entryPointIndex));
+            m_parameterSpaces.push_back(toSnapshotSize(parameter->getBindingSpace(slotCategory)));
+            m_parameterOffsets.push_back(toSnapshotSize(parameter->getOffset(slotCategory)));
+            m_parameterSizes.push_back(toSnapshotSize(typeLayout->getSize(slotCategory)));
+            m_parameterElementCounts.push_back(
+                typeLayout->getKind() == TypeReflection::Kind::Array ? toSnapshotSize(typeLayout->getElementCount()) : 1);
+
+            // Constant buffers, parameter blocks and push constants report the size of their contents
+            TypeLayoutReflection *dataLayout = typeLayout;
+            switch (typeLayout->getKind())
+            {
+            case TypeReflection::Kind::ConstantBuffer:
+            case TypeReflection::Kind::ParameterBlock:
+            case TypeReflection::Kind::TextureBuffer:
+            case TypeReflection::Kind::ShaderStorageBuffer:
+                if (typeLayout->getElementTypeLayout())
+                    dataLayout = typeLayout->getElementTypeLayout();
+                break;
+            default:
+                break;
+            }
+            uint32_t dataSize = toSnapshotSize(dataLayout->getSize(SLANG_PARAMETER_CATEGORY_UNIFORM));
+            m_parameterDataSizes.push_back(dataSize);
+
+            if (category == SLANG_PARAMETER_CATEGORY_PUSH_CONSTANT_BUFFER)
+            {
+                m_pushConstantSizes.push_back(dataSize);
+                m_pushConstantEntryPoints.push_back(static_cast<uint32_t>(entryPointIndex));
+                m_pushConstantParameters.push_back(parameterIndex);
+            }
+        }
+
+        // Adds the descriptor ranges of a scope. Ranges in the scope's own descriptor set
+        // are relative to the scope's offsets; other sets are relative to its sub-element spaces.
+        void addDescriptorRanges(VariableLayoutReflection *scope, int32_t entryPointIndex)
+        {
+            TypeLayoutReflection *typeLayout = scope->getTypeLayout();
+            size_t subElementSpace = scope->getOffset(SLANG_PARAMETER_CATEGORY_SUB_ELEMENT_REGISTER_SPACE);
+            for (SlangInt set = 0; set < typeLayout->getDescriptorSetCount(); set++)
+            {
+                SlangInt spaceOffset = typeLayout->getDescriptorSetSpaceOffset(set);
+                for (SlangInt range = 0; range < typeLayout->getDescriptorSetDescriptorRangeCount(set); range++)
+                {
+                    SlangParameterCategory category = static_cast<SlangParameterCategory>(
+                        typeLayout->getDescriptorSetDescriptorRangeCategory(set, range));
+                    size_t space = static_cast<size_t>(spaceOffset) + subElementSpace;
+                    size_t index = static_cast<size_t>(typeLayout->getDescriptorSetDescriptorRangeIndexOffset(set, range));
+                    if (spaceOffset == 0)
+                    {
+                        space = scope->getBindingSpace(category);
+                        index += scope->getOffset(category);
+                    }
+
+                    m_bindingSets.push_back(toSnapshotSize(space));
+                    m_bindingIndices.push_back(toSnapshotSize(index));
+                    m_bindingDescriptorCounts.push_back(toSnapshotSize(static_cast<size_t>(
+                        typeLayout->getDescriptorSetDescriptorRangeDescriptorCount(set, range))));
+                    m_bindingTypes.push_back(static_cast<uint32_t>(typeLayout->getDescriptorSetDescriptorRangeType(set, range)));
+                    m_bindingCategories.push_back(static_cast<uint32_t>(category));
+                    m_bindingEntryPoints.push_back(static_cast<uint32_t>(entryPointIndex));
+                }
+            }
+        }
+
+        std::vector<uint8_t> build() const
+        {
+            SlangcReflectionSnapshot header = {};
+            header.magic = SLANGC_REFLECTION_MAGIC;
+            header.version = SLANGC_REFLECTION_VERSION;
+            header.entryPointCount = static_cast<uint32_t>(m_entryPointNames.size());
+            header.parameterCount = static_cast<uint32_t>(m_parameterNames.size());
+            header.bindingCount = static_cast<uint32_t>(m_bindingSets.size());
+            header.pushConstantCount = static_cast<uint32_t>(m_pushConstantSizes.size());
+            header.stringTableSize = static_cast<uint32_t>(m_strings.size());
+
+            LayoutHashes layout = computeLayoutHashes();
+            header.layoutHash = layout.layoutHash;
+            header.setCount = static_cast<uint32_t>(layout.setIndices.size());
+
+            std::vector<uint8_t> data(sizeof(header));
+            auto appendArray = [&data](const auto &values)
+            {
+                using Value = typename std::decay_t<decltype(values)>::value_type;
+                data.resize((data.size() + alignof(Value) - 1) & ~(alignof(Value) - 1));
+                auto offset = static_cast<uint32_t>(data.size());
+                data.resize(data.size() + values.size() * sizeof(Value));
+                if (!values.empty())
+                    std::memcpy(data.data() + offset, values.data(), values.size() * sizeof(Value));
+                return offset;
+            };
+
+            header.entryPointNames = appendArray(m_entryPointNames);
+            header.entryPointStages = appendArray(m_entryPointStages);
+            header.entryPointThreadGroupSizes = appendArray(m_entryPointThreadGroupSizes);
+            header.parameterNames = appendArray(m_parameterNames);
+            header.parameterTypeNames = appendArray(m_parameterTypeNames);
+            header.parameterTypeKinds = appendArray(m_parameterTypeKinds);
+            header.parameterCategories = appendArray(m_parameterCategories);
+            header.parameterEntryPoints = appendArray(m_parameterEntryPoints);
+            header.parameterSpaces = appendArray(m_parameterSpaces);
+            header.parameterOffsets = appendArray(m_parameterOffsets);
+            header.parameterSizes = appendArray(m_parameterSizes);
+            header.parameterElementCounts = appendArray(m_parameterElementCounts);
+            header.parameterDataSizes = appendArray(m_parameterDataSizes);
+            header.bindingSets = appendArray(m_bindingSets);
+            header.bindingIndices = appendArray(m_bindingIndices);
+            header.bindingDescriptorCounts = appendArray(m_bindingDescriptorCounts);
+            header.bindingTypes = appendArray(m_bindingTypes);
+            header.bindingCategories = appendArray(m_bindingCategories);
+            header.bindingEntryPoints = appendArray(m_bindingEntryPoints);
+            header.bindingStageMasks = appendArray(layout.bindingStageMasks);
+            header.setIndices = appendArray(layout.setIndices);
+            header.setHashes = appendArray(layout.setHashes);
+            header.pushConstantSizes = appendArray(m_pushConstantSizes);
+            header.pushConstantEntryPoints = appendArray(m_pushConstantEntryPoints);
+            header.pushConstantParameters = appendArray(m_pushConstantParameters);
+            header.pushConstantStageMasks = appendArray(layout.pushConstantStageMasks);
+            header.pushConstantHashes = appendArray(layout.pushConstantHashes);
+
+            header.stringTable = static_cast<uint32_t>(data.size());
+            data.insert(data.end(), m_strings.begin(), m_strings.end());
+            data.resize((data.size() + 7) & ~size_t(7));
+
+            header.totalSize = static_cast<uint32_t>(data.size());
+            std::memcpy(data.data(), &header, sizeof(header));
+            return data;
+        }
+
+    private:
+        struct LayoutHashes
+        {
+            std::vector<uint32_t> bindingStageMasks;
+            std::vector<uint32_t> setIndices;
+            std::vector<uint64_t> setHashes;
+            std::vector<uint32_t> pushConstantStageMasks;
+            std::vector<uint64_t> pushConstantHashes;
+            uint64_t layoutHash = 0;
+        };
+
+        // Global scope bindings are visible to every stage in the program
+        uint32_t getStageMask(uint32_t entryPointIndex) const
+        {
+            if (entryPointIndex < m_entryPointStages.size())
+                return 1u << m_entryPointStages[entryPointIndex];
+
+            uint32_t mask = 0;
+            for (uint32_t stage : m_entryPointStages)
+                mask |= 1u << stage;
+            return mask;
+        }
+
+        LayoutHashes computeLayoutHashes() const
+        {
+            LayoutHashes hashes;
+
+            // Collect each set's ranges as (binding, category, type, count, stages),
+            // merging ranges that only differ in the stages that use them
+            std::map<uint32_t, std::vector<std::array<uint32_t, 5>>> sets;
+            for (size_t i = 0; i < m_bindingSets.size(); i++)
+            {
+                uint32_t stageMask = getStageMask(m_bindingEntryPoints[i]);
+                hashes.bindingStageMasks.push_back(stageMask);
+
+                std::array<uint32_t, 5> range = {
+                    m_bindingIndices[i], m_bindingCategories[i], m_bindingTypes[i], m_bindingDescriptorCounts[i], stageMask};
+                auto &ranges = sets[m_bindingSets[i]];
+                auto existing = std::find_if(ranges.begin(), ranges.end(), [&range](const std::array<uint32_t, 5> &other)
+                                             { return std::equal(range.begin(), range.begin() + 4, other.begin()); });
+                if (existing != ranges.end())
+                    (*existing)[4] |= stageMask;
+                else
+                    ranges.push_back(range);
+            }
+
+            std::vector<uint64_t> programHash;
+            for (auto &set : sets)
+            {
+                std::sort(set.second.begin(), set.second.end());
+                uint64_t setHash = hashBytes(set.second.data(), set.second.size() * sizeof(set.second[0]));
+                hashes.setIndices.push_back(set.first);
+                hashes.setHashes.push_back(setHash);
+                programHash.push_back(set.first);
+                programHash.push_back(setHash);
+            }
+
+            for (size_t i = 0; i < m_pushConstantSizes.size(); i++)
+            {
+                uint32_t range[2] = {m_pushConstantSizes[i], getStageMask(m_pushConstantEntryPoints[i])};
+                hashes.pushConstantStageMasks.push_back(range[1]);
+                hashes.pushConstantHashes.push_back(hashBytes(range, sizeof(range)));
+            }
+            std::vector<uint64_t> pushConstantHashes = hashes.pushConstantHashes;
+            std::sort(pushConstantHashes.begin(), pushConstantHashes.end());
+            programHash.push_back(pushConstantHashes.size());
+            programHash.insert(programHash.end(), pushConstantHashes.begin(), pushConstantHashes.end());
+
+            hashes.layoutHash = hashBytes(programHash.data(), programHash.size() * sizeof(uint64_t));
+            return hashes;
+        }
+
+        // Returns the offset of a string in the string table, adding it on first use
+        uint32_t addString(const char *text)
+        {
+            std::string value = text ? text : "";
+            auto found = m_stringOffsets.find(value);
+            if (found != m_stringOffsets.end())
+                return found->second;
+
+            auto offset = static_cast<uint32_t>(m_strings.size());
+            m_strings.insert(m_strings.end(), value.begin(), value.end());
+            m_strings.push_back('\0');
+            m_stringOffsets.emplace(std::move(value), offset);
+            return offset;
+        }
+
+        std::vector<uint32_t> m_entryPointNames;
+        std::vector<uint32_t> m_entryPointStages;
+        std::vector<uint32_t> m_entryPointThreadGroupSizes;
+        std::vector<uint32_t> m_parameterNames;
+        std::vector<uint32_t> m_parameterTypeNames;
+        std::vector<uint32_t> m_parameterTypeKinds;
+        std::vector<uint32_t> m_parameterCategories;
+        std::vector<uint32_t> m_parameterEntryPoints;
+        std::vector<uint32_t> m_parameterSpaces;
+        std::vector<uint32_t> m_parameterOffsets;
+        std::vector<uint32_t> m_parameterSizes;
+        std::vector<uint32_t> m_parameterElementCounts;
+        std::vector<uint32_t> m_parameterDataSizes;
+        std::vector<uint32_t> m_bindingSets;
+        std::vector<uint32_t> m_bindingIndices;
+        std::vector<uint32_t> m_bindingDescriptorCounts;
+        std::vector<uint32_t> m_bindingTypes;
+        std::vector<uint32_t> m_bindingCategories;
+        std::vector<uint32_t> m_bindingEntryPoints;
+        std::vector<uint32_t> m_pushConstantSizes;
+        std::vector<uint32_t> m_pushConstantEntryPoints;
+        std::vector<uint32_t> m_pushConstantParameters;
+        std::vector<char> m_strings;
+        std::unordered_map<std::string, uint32_t> m_stringOffsets;
+    };
+}
+
+SlangcBlob *slangc_buildReflectionSnapshot(
+    SlangcComponentType *componentType,
+    int32_t targetIndex,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!slangComponentType || targetIndex < 0)
+    {
+        setError("Invalid parameters for reflection snapshot");
+        return nullptr;
+    }
+
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    ProgramLayout *layout = slangComponentType->getLayout(targetIndex, diagnostics.writeRef());
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    if (!layout)
+    {
+        setError("Failed to get program layout");
+        return nullptr;
+    }
+
+    ReflectionSnapshotBuilder builder;
+    for (unsigned i = 0; i < layout->getParameterCount(); i++)
+        builder.addParameter(layout->getParameterByIndex(i), -1);
+    if (VariableLayoutReflection *globals = layout->getGlobalParamsVarLayout())
+        builder.addDescriptorRanges(globals, -1);
+
+    for (SlangUInt i = 0; i < layout->getEntryPointCount(); i++)
+    {
+        EntryPointReflection *entryPoint = layout->getEntryPointByIndex(i);
+        auto entryPointIndex = static_cast<int32_t>(i);
+        builder.addEntryPoint(entryPoint);
+        for (unsigned p = 0; p < entryPoint->getParameterCount(); p++)
+            builder.addParameter(entryPoint->getParameterByIndex(p), entryPointIndex);
+        if (VariableLayoutReflection *scope = entryPoint->getVarLayout())
+            builder.addDescriptorRanges(scope, entryPointIndex);
+    }
+
+    Slang::ComPtr<ISlangBlob> snapshot(new OwnedBlob(builder.build()));
+    auto snapshotWrapper = std::make_unique<SlangcBlob>();
+    snapshotWrapper->blob = snapshot;
+    return snapshotWrapper.release();
+}
+
+namespace
+{
+    // Checks that every array and name of a snapshot lies inside its first size bytes
+    bool isReflectionSnapshotValid(const void *data, size_t size)
+    {
+        if (!data || size < sizeof(SlangcReflectionSnapshot) || reinterpret_cast<uintptr_t>(data) % alignof(uint64_t) != 0)
+            return false;
+
+        auto snapshot = static_cast<const SlangcReflectionSnapshot *>(data);
+        if (snapshot->magic != SLANGC_REFLECTION_MAGIC || snapshot->version != SLANGC_REFLECTION_VERSION ||
+            snapshot->totalSize > size || snapshot->stringTable > snapshot->totalSize ||
+            snapshot->stringTableSize > snapshot->totalSize - snapshot->stringTable)
+            return false;
+
+        // Every array must lie between the header and the string table
+        struct SnapshotArray
+        {
+            uint32_t offset;
+            uint64_t count;
+            uint32_t elementSize;
+        };
+        const SnapshotArray arrays[] = {
+            {snapshot->entryPointNames, snapshot->entryPointCount, 4},
+            {snapshot->entryPointStages, snapshot->entryPointCount, 4},
+            {snapshot->entryPointThreadGroupSizes, uint64_t(snapshot->entryPointCount) * 3, 4},
+            {snapshot->parameterNames, snapshot->parameterCount, 4},
+            {snapshot->parameterTypeNames, snapshot->parameterCount, 4},
+            {snapshot->parameterTypeKinds, snapshot->parameterCount, 4},
+            {snapshot->parameterCategories, snapshot->parameterCount, 4},
+            {snapshot->parameterEntryPoints, snapshot->parameterCount, 4},
+            {snapshot->parameterSpaces, snapshot->parameterCount, 4},
+            {snapshot->parameterOffsets, snapshot->parameterCount, 4},
+            {snapshot->parameterSizes, snapshot->parameterCount, 4},
+            {snapshot->parameterElementCounts, snapshot->parameterCount, 4},
+            {snapshot->parameterDataSizes, snapshot->parameterCount, 4},
+            {snapshot->bindingSets, snapshot->bindingCount, 4},
+            {snapshot->bindingIndices, snapshot->bindingCount, 4},
+            {snapshot->bindingDescriptorCounts, snapshot->bindingCount, 4},
+            {snapshot->bindingTypes, snapshot->bindingCount, 4},
+            {snapshot->bindingCategories, snapshot->bindingCount, 4},
+            {snapshot->bindingEntryPoints, snapshot->bindingCount, 4},
+            {snapshot->bindingStageMasks, snapshot->bindingCount, 4},
+            {snapshot->setIndices, snapshot->setCount, 4},
+            {snapshot->setHashes, snapshot->setCount, 8},
+            {snapshot->pushConstantSizes, snapshot->pushConstantCount, 4},
+            {snapshot->pushConstantEntryPoints, snapshot->pushConstantCount, 4},
+            {snapshot->pushConstantParameters, snapshot->pushConstantCount, 4},
+            {snapshot->pushConstantStageMasks, snapshot->pushConstantCount, 4},
+            {snapshot->pushConstantHashes, snapshot->pushConstantCount, 8},
+        };
+        for (const auto &array : arrays)
+        {
+            uint64_t end = uint64_t(array.offset) + array.count * array.elementSize;
+            if (array.offset < sizeof(SlangcReflectionSnapshot) || array.offset % array.elementSize != 0 ||
+                end > snapshot->stringTable)
+                return false;
+        }
+
+        // Every name must start inside the string table, and the table must end with a
+        // terminator so no string runs past it
+        auto bytes = static_cast<const char *>(data);
+        if (snapshot->stringTableSize > 0 && bytes[snapshot->stringTable + snapshot->stringTableSize - 1] != '\0')
+            return false;
+        const SnapshotArray nameArrays[] = {
+            {snapshot->entryPointNames, snapshot->entryPointCount, 4},
+            {snapshot->parameterNames, snapshot->parameterCount, 4},
+            {snapshot->parameterTypeNames, snapshot->parameterCount, 4},
+        };
+        for (const auto &array : nameArrays)
+        {
+            auto offsets = reinterpret_cast<const uint32_t *>(bytes + array.offset);
+            for (uint64_t i = 0; i < array.count; i++)
+            {
+                if (offsets[i] >= snapshot->stringTableSize)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+const SlangcReflectionSnapshot *slangc_getReflectionSnapshot(const void *data, size_t size)
+{
+    clearError();
+    if (!data || size < sizeof(SlangcReflectionSnapshot) || reinterpret_cast<uintptr_t>(data) % alignof(uint64_t) != 0)
+    {
+        setError("Invalid reflection snapshot data");
+        return nullptr;
+    }
+    if (!isReflectionSnapshotValid(data, size))
+    {
+        setError("Reflection snapshot is corrupt or from an incompatible version");
+        return nullptr;
+    }
+    return static_cast<const SlangcReflectionSnapshot *>(data);
+}
+
+int32_t slangc_groupProgramsByLayout(
+    const SlangcReflectionSnapshot *const *snapshots,
+    int32_t snapshotCount,
+    int32_t *outGroupIndices)
+{
+    clearError();
+    if (snapshotCount < 0 || (snapshotCount > 0 && (!snapshots || !outGroupIndices)))
+    {
+        setError("Invalid parameters for layout grouping");
+        return -1;
+    }
+
+    // Key each program by its set numbers and per-set and push-constant hashes
+    std::unordered_map<std::string, int32_t> groups;
+    for (int32_t i = 0; i < snapshotCount; i++)
+    {
+        const SlangcReflectionSnapshot *snapshot = snapshots[i];
+        if (!snapshot || !isReflectionSnapshotValid(snapshot, snapshot->totalSize))
+        {
+            setError("Invalid reflection snapshot at index " + std::to_string(i));
+            return -1;
+        }
+
+        auto base = reinterpret_cast<const char *>(snapshot);
+        auto setIndices = reinterpret_cast<const uint32_t *>(base + snapshot->setIndices);
+        auto setHashes = reinterpret_cast<const uint64_t *>(base + snapshot->setHashes);
+        std::vector<uint64_t> pushConstantHashes(
+            reinterpret_cast<const uint64_t *>(base + snapshot->pushConstantHashes),
+            reinterpret_cast<const uint64_t *>(base + snapshot->pushConstantHashes) + snapshot->pushConstantCount);
+        std::sort(pushConstantHashes.begin(), pushConstantHashes.end());
+
+        std::string key;
+        auto appendValue = [&key](const void *value, size_t size)
+        { key.append(static_cast<const char *>(value), size); };
+        appendValue(&snapshot->layoutHash, sizeof(snapshot->layoutHash));
+        appendValue(&snapshot->setCount, sizeof(snapshot->setCount));
+        appendValue(setIndices, snapshot->setCount * sizeof(uint32_t));
+        appendValue(setHashes, snapshot->setCount * sizeof(uint64_t));
+        appendValue(pushConstantHashes.data(), pushConstantHashes.size() * sizeof(uint64_t));
+
+        auto inserted = groups.emplace(std::move(key), static_cast<int32_t>(groups.size()));
+        outGroupIndices[i] = inserted.first->second;
+    }
+
+    return static_cast<int32_t>(groups.size());
+}
+
+SlangcResult slangc_getUsedBindings(
+    SlangcComponentType *componentType,
+    int32_t entryPointIndex,
+    int32_t targetIndex,
+    const SlangcReflectionSnapshot *snapshot,
+    uint32_t *outBits,
+    SlangcBlob **outDiagnostics)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return SLANGC_FAIL;
+    }
+
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!slangComponentType || targetIndex < 0 || !snapshot || !outBits ||
+        !isReflectionSnapshotValid(snapshot, snapshot->totalSize))
+    {
+        setError("Invalid parameters for used bindings");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    Slang::ComPtr<IMetadata> metadata;
+    Slang::ComPtr<ISlangBlob> diagnostics;
+    SlangResult result = entryPointIndex < 0
+                             ? slangComponentType->getTargetMetadata(targetIndex, metadata.writeRef(), diagnostics.writeRef())
+                             : slangComponentType->getEntryPointMetadata(
+                                   entryPointIndex, targetIndex, metadata.writeRef(), diagnostics.writeRef());
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
+    if (SLANG_FAILED(result) || !metadata)
+    {
+        setError("Failed to get metadata for used bindings");
+        return SLANGC_FAIL;
+    }
+
+    auto base = reinterpret_cast<const char *>(snapshot);
+    auto sets = reinterpret_cast<const uint32_t *>(base + snapshot->bindingSets);
+    auto indices = reinterpret_cast<const uint32_t *>(base + snapshot->bindingIndices);
+    auto categories = reinterpret_cast<const uint32_t *>(base + snapshot->bindingCategories);
+    auto entryPoints = reinterpret_cast<const int32_t *>(base + snapshot->bindingEntryPoints);
+
+    std::fill(outBits, outBits + (snapshot->bindingCount + 31) / 32, 0u);
+    for (uint32_t i = 0; i < snapshot->bindingCount; i++)
+    {
+        // Another entry point's parameters are never used by this one
+        if (entryPointIndex >= 0 && entryPoints[i] >= 0 && entryPoints[i] != entryPointIndex)
+            continue;
+
+        // Ranges Slang cannot report on are treated as used
+        bool used = false;
+        if (SLANG_FAILED(metadata->isParameterLocationUsed(
+                static_cast<SlangParameterCategory>(categories[i]), sets[i], indices[i], used)) ||
+            used)
+            outBits[i / 32] |= 1u << (i % 32);
+    }
+
+    return SLANGC_OK;
+}
+
+//
+// Batch Compilation
+//
+
+namespace
+{
+    // Jobs per task; small enough to balance load, large enough to amortize pool round trips
+    const size_t kBatchChunkSize = 4;
+
+    // Jobs that share a module and macro set
+    struct BatchGroup
+    {
+        std::string key;
+        std::string macroKey;
+        std::vector<int32_t> jobIndices;
+    };
+
+    // Session settings shared by every job of a batch or executor
+    struct CompileSettings
+    {
+        const char **searchPaths = nullptr;
+        int32_t searchPathCount = 0;
+        SlangcMatrixLayoutMode matrixLayoutMode = SLANGC_MATRIX_LAYOUT_ROW_MAJOR;
+        SlangcCache *cache = nullptr;
+        SlangcFileSystem *fileSystem = nullptr;
+        SlangcProfile *timingProfile = nullptr;
+        bool checkSourceChanges = false; // Reload sessions whose source files changed since they were used
+    };
+
+    // Size and modification time of a source file when a module read it
+    struct SourceFileStamp
+    {
+        std::string path;
+        std::filesystem::file_time_type modified;
+        uintmax_t size;
+    };
+
+    SourceFileStamp stampSourceFile(const std::string &path)
+    {
+        std::error_code ec;
+        SourceFileStamp stamp = {path, std::filesystem::last_write_time(path, ec), 0};
+        if (ec)
+            stamp.modified = std::filesystem::file_time_type();
+        stamp.size = std::filesystem::file_size(path, ec);
+        if (ec)
+            stamp.size = static_cast<uintmax_t>(-1);
+        return stamp;
+    }
+
+    // Files the modules of one session were checked from
+    struct CompileSessionSources
+    {
+        std::vector<SourceFileStamp> files;
+        bool reload = false; // A module failed to load, so its files are unknown
+    };
+
+    // Objects created from one global session on behalf of a batch or executor. Only
+    // touched while that global session is checked out of its pool.
+    struct CompileSessionContext
+    {
+        std::unordered_map<std::string, SlangcSession *> sessions;             // Keyed by session key
+        std::unordered_map<std::string, SlangcModule *> modules;               // Keyed by session key and module name
+        std::unordered_map<std::string, std::string> moduleDiagnostics;        // Keyed like modules
+        std::unordered_map<std::string, CompileSessionSources> sessionSources; // Keyed by session key, with checkSourceChanges
+    };
+
+    struct BatchState
+    {
+        CompileSettings settings;
+        const SlangcCompileJob *jobs;
+        SlangcCompileJobResult *results;
+        std::vector<SlangcCompileTarget> targets; // Distinct targets, shared by every session
+        std::vector<int32_t> targetIndices;       // Per job index into targets
+        SlangcSessionPool *pool;
+        std::mutex contextMutex;
+        std::unordered_map<SlangcGlobalSession *, CompileSessionContext> contexts;
+    };
+
+    void appendDiagnostics(std::string &text, SlangcBlob *diagnostics)
+    {
+        if (!diagnostics)
+            return;
+
+        auto data = static_cast<const char *>(slangc_getBlobData(diagnostics));
+        size_t size = slangc_getBlobSize(diagnostics);
+        text.append(data, strnlen(data, size));
+        slangc_releaseBlob(diagnostics);
+    }
+
+    SlangcBlob *createTextBlob(const std::string &text)
+    {
+        if (text.empty())
+            return nullptr;
+
+        auto wrapper = std::make_unique<SlangcBlob>();
+        wrapper->blob = OwnedBlob::createText(text);
+        return wrapper.release();
+    }
+
+    void failCompileJob(SlangcCompileJobResult &result, SlangcResult code, std::string diagnostics)
+    {
+        if (diagnostics.empty() && slangc_hasError())
+            diagnostics = slangc_getLastError();
+
+        result.result = code;
+        result.code = nullptr;
+        result.diagnostics = createTextBlob(diagnostics);
+    }
+
+    // Releases a session and every module loaded in it, since the session also holds
+    // the modules those imported
+    void dropCompileSession(CompileSessionContext &context, const std::string &sessionKey)
+    {
+        std::string prefix = sessionKey + '\0';
+        for (auto it = context.modules.begin(); it != context.modules.end();)
+        {
+            if (it->first.compare(0, prefix.size(), prefix) != 0)
+            {
+                ++it;
+                continue;
+            }
+            slangc_releaseModule(it->second);
+            context.moduleDiagnostics.erase(it->first);
+            it = context.modules.erase(it);
+        }
+
+        auto session = context.sessions.find(sessionKey);
+        if (session != context.sessions.end())
+        {
+            slangc_releaseSession(session->second);
+            context.sessions.erase(session);
+        }
+        context.sessionSources.erase(sessionKey);
+    }
+
+    bool haveSessionSourcesChanged(const CompileSessionSources &sources)
+    {
+        if (sources.reload)
+            return true;
+        for (const SourceFileStamp &file : sources.files)
+        {
+            SourceFileStamp current = stampSourceFile(file.path);
+            if (current.modified != file.modified || current.size != file.size)
+                return true;
+        }
+        return false;
+    }
+
+    // Finds or creates the session for sessionKey (using the job's macros and the given
+    // targets), then loads the job's module in it. The module is loaded and checked once
+    // per session; later calls return the same module and its load diagnostics. With
+    // checkSourceChanges, a session whose files changed is dropped and built again.
+    SlangcModule *prepareCompileModule(
+        CompileSessionContext &context,
+        SlangcGlobalSession *globalSession,
+        const CompileSettings &settings,
+        const std::string &sessionKey,
+        SlangcCompileTarget *targets,
+        int32_t targetCount,
+        const SlangcCompileJob &job,
+        SlangcSession *&outSession,
+        const std::string *&outModuleDiagnostics)
+    {
+        if (settings.checkSourceChanges)
+        {
+            auto sources = context.sessionSources.find(sessionKey);
+            if (sources != context.sessionSources.end() && haveSessionSourcesChanged(sources->second))
+            {
+                dropCompileSession(context, sessionKey);
+                if (settings.fileSystem)
+                    slangc_clearFileSystemCache(settings.fileSystem);
+            }
+        }
+
+        std::string moduleKey = sessionKey + '\0' + job.moduleName;
+        outModuleDiagnostics = &context.moduleDiagnostics[moduleKey];
+
+        SlangcSession *&session = context.sessions[sessionKey];
+        if (!session)
+        {
+            SlangcSessionDesc sessionDesc = {};
+            sessionDesc.targets = targets;
+            sessionDesc.targetCount = targetCount;
+            sessionDesc.searchPaths = settings.searchPaths;
+            sessionDesc.searchPathCount = settings.searchPathCount;
+            sessionDesc.preprocessorMacros = job.preprocessorMacros;
+            sessionDesc.preprocessorMacroCount = job.preprocessorMacroCount;
+            sessionDesc.matrixLayoutMode = settings.matrixLayoutMode;
+            sessionDesc.cache = settings.cache;
+            sessionDesc.fileSystem = settings.fileSystem;
+            sessionDesc.timingProfile = settings.timingProfile;
+            session = createSessionFromDesc(globalSession, &sessionDesc, SLANG_PROFILE_UNKNOWN);
+        }
+        outSession = session;
+        if (!session)
+            return nullptr;
+
+        auto it = context.modules.find(moduleKey);
+        if (it != context.modules.end())
+            return it->second;
+
+        SlangcBlob *loadDiagnostics = nullptr;
+        SlangcModule *module = slangc_loadModule(session, job.moduleName, &loadDiagnostics);
+        appendDiagnostics(context.moduleDiagnostics[moduleKey], loadDiagnostics);
+        context.modules[moduleKey] = module;
+
+        if (settings.checkSourceChanges)
+        {
+            CompileSessionSources &sources = context.sessionSources[sessionKey];
+            if (!module)
+                sources.reload = true;
+            for (int32_t f = 0; module && f < module->module->getDependencyFileCount(); f++)
+                sources.files.push_back(stampSourceFile(module->module->getDependencyFilePath(f)));
+        }
+        return module;
+    }
+
+    void compileJob(
+        SlangcSession *session,
+        SlangcModule *module,
+        const SlangcCompileJob &job,
+        int32_t targetIndex,
+        const std::string &moduleDiagnostics,
+        SlangcCompileJobResult &result)
+    {
+        std::string diagnostics = moduleDiagnostics;
+        SlangcBlob *stageDiagnostics = nullptr;
+
+        SlangcEntryPoint *entryPoint = slangc_findEntryPoint(module, job.entryPointName, job.stage, &stageDiagnostics);
+        appendDiagnostics(diagnostics, stageDiagnostics);
+        if (!entryPoint)
+        {
+            failCompileJob(result, SLANGC_FAIL, diagnostics);
+            return;
+        }
+
+        SlangcComponentType components[2] = {};
+        components[0].kind = SLANGC_COMPONENT_TYPE_MODULE;
+        components[0].module = module;
+        components[1].kind = SLANGC_COMPONENT_TYPE_ENTRY_POINT;
+        components[1].entryPoint = entryPoint;
+
+        stageDiagnostics = nullptr;
+        SlangcComponentType *program = slangc_createCompositeComponentType(session, components, 2, &stageDiagnostics);
+        appendDiagnostics(diagnostics, stageDiagnostics);
+
+        SlangcComponentType *linkedProgram = nullptr;
+        if (program)
+        {
+            stageDiagnostics = nullptr;
+            linkedProgram = slangc_linkComponentType(program, &stageDiagnostics);
+            appendDiagnostics(diagnostics, stageDiagnostics);
+        }
+
+        SlangcBlob *code = nullptr;
+        if (linkedProgram)
+        {
+            stageDiagnostics = nullptr;
+            code = slangc_getEntryPointCode(linkedProgram, 0, targetIndex, &stageDiagnostics);
+            appendDiagnostics(diagnostics, stageDiagnostics);
+        }
+
+        if (code && job.depfilePath)
+        {
+            const char *targetPath = job.outputPath ? job.outputPath : job.entryPointName;
+            if (!writeDepfile(linkedProgram, targetPath, job.depfilePath))
+            {
+                diagnostics += "error: failed to write depfile '" + std::string(job.depfilePath) + "'\n";
+                slangc_releaseBlob(code);
+                code = nullptr;
+            }
+        }
+
+        if (code)
+        {
+            result.result = SLANGC_OK;
+            result.code = code;
+            result.diagnostics = createTextBlob(diagnostics);
+        }
+        else
+        {
+            failCompileJob(result, SLANGC_FAIL, diagnostics);
+        }
+
+        slangc_releaseComponentType(linkedProgram);
+        slangc_releaseComponentType(program);
+        slangc_releaseEntryPoint(entryPoint);
+    }
+
+    // Returns a checked-out global session to its pool when the scope ends, so an exception
+    // cannot leave it checked out and block the batch teardown
+    class GlobalSessionLease
+    {
+    public:
+        GlobalSessionLease(SlangcSessionPool *pool, SlangcGlobalSession *globalSession)
+            : m_pool(pool), m_globalSession(globalSession) {}
+
+        ~GlobalSessionLease()
+        {
+            if (m_globalSession)
+                slangc_returnGlobalSession(m_pool, m_globalSession);
+        }
+
+        GlobalSessionLease(const GlobalSessionLease &) = delete;
+        GlobalSessionLease &operator=(const GlobalSessionLease &) = delete;
+
+    private:
+        SlangcSessionPool *m_pool;
+        SlangcGlobalSession *m_globalSession;
+    };
+
+    void compileBatchChunk(BatchState &state, const BatchGroup &group, size_t begin, size_t end)
+    {
+        SlangcGlobalSession *globalSession = slangc_acquireGlobalSession(state.pool);
+        if (!globalSession)
+        {
+            for (size_t i = begin; i < end; i++)
+                failCompileJob(state.results[group.jobIndices[i]], SLANGC_FAIL, "");
+            return;
+        }
+        GlobalSessionLease lease(state.pool, globalSession);
+
+        CompileSessionContext *context;
+        {
+            std::lock_guard<std::mutex> lock(state.contextMutex);
+            context = &state.contexts[globalSession];
+        }
+
+        // One session per macro set, holding every target used by the batch
+        SlangcSession *session = nullptr;
+        const std::string *moduleDiagnostics = nullptr;
+        SlangcModule *module = prepareCompileModule(
+            *context,
+            globalSession,
+            state.settings,
+            group.macroKey,
+            state.targets.data(),
+            static_cast<int32_t>(state.targets.size()),
+            state.jobs[group.jobIndices[0]],
+            session,
+            moduleDiagnostics);
+
+        for (size_t i = begin; i < end; i++)
+        {
+            int32_t jobIndex = group.jobIndices[i];
+            if (!module)
+            {
+                failCompileJob(state.results[jobIndex], SLANGC_FAIL, *moduleDiagnostics);
+                continue;
+            }
+            compileJob(
+                session,
+                module,
+                state.jobs[jobIndex],
+                state.targetIndices[jobIndex],
+                *moduleDiagnostics,
+                state.results[jobIndex]);
+        }
+    }
+
+    void releaseCompileSessionContext(CompileSessionContext &context)
+    {
+        for (auto &module : context.modules)
+            slangc_releaseModule(module.second);
+        for (auto &session : context.sessions)
+            slangc_releaseSession(session.second);
+        context.modules.clear();
+        context.sessions.clear();
+        context.moduleDiagnostics.clear();
+        context.sessionSources.clear();
+    }
+}
+
+SlangcResult slangc_compileBatch(
+    const SlangcBatchDesc *desc,
+    const SlangcCompileJob *jobs,
+    int32_t jobCount,
+    SlangcCompileJobResult *outResults)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return SLANGC_FAIL;
+    }
+
+    if (!desc || jobCount < 0 || (jobCount > 0 && (!jobs || !outResults)))
+    {
+        setError("Invalid parameters for batch compile");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    BatchState state;
+    state.settings.searchPaths = desc->searchPaths;
+    state.settings.searchPathCount = desc->searchPathCount;
+    state.settings.matrixLayoutMode = desc->matrixLayoutMode;
+    state.settings.cache = desc->cache;
+    state.settings.fileSystem = desc->fileSystem;
+    state.settings.timingProfile = desc->timingProfile;
+    state.jobs = jobs;
+    state.results = outResults;
+    state.targetIndices.resize(jobCount, 0);
+
+    // Group jobs by module and macro set, in first-seen order
+    std::vector<BatchGroup> groups;
+    std::unordered_map<std::string, size_t> groupIndices;
+    int32_t invalidJobCount = 0;
+    for (int32_t i = 0; i < jobCount; i++)
+    {
+        const SlangcCompileJob &job = jobs[i];
+
+        // Jobs count as failed until compiled, in case a worker task throws
+        outResults[i] = {};
+        outResults[i].result = SLANGC_FAIL;
+        if (!job.moduleName || !job.entryPointName)
+        {
+            outResults[i].result = SLANGC_E_INVALID_ARG;
+            outResults[i].diagnostics = createTextBlob("Invalid module or entry point name");
+            invalidJobCount++;
+            continue;
+        }
+
+        auto target = std::find(state.targets.begin(), state.targets.end(), job.target);
+        if (target == state.targets.end())
+            target = state.targets.insert(state.targets.end(), job.target);
+        state.targetIndices[i] = static_cast<int32_t>(target - state.targets.begin());
+
+        std::string macroKey = makeMacroKey(job.preprocessorMacros, job.preprocessorMacroCount);
+        std::string key = macroKey + '\0' + job.moduleName;
+        auto inserted = groupIndices.emplace(key, groups.size());
+        if (inserted.second)
+            groups.push_back({key, macroKey, {}});
+        groups[inserted.first->second].jobIndices.push_back(i);
+    }
+
+    int32_t threadCount = desc->threadCount > 0
+                              ? desc->threadCount
+                              : std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+
+    state.pool = desc->pool;
+    if (!state.pool)
+    {
+        SlangcSessionPoolDesc poolDesc = {};
+        poolDesc.maxGlobalSessions = threadCount;
+        state.pool = slangc_createSessionPool(&poolDesc);
+        if (!state.pool)
+            return SLANGC_FAIL;
+    }
+
+    if (!groups.empty())
+    {
+        WorkStealingPool workers(threadCount);
+
+        // Seed each group's chunks onto one worker so it usually checks the module once;
+        // idle workers steal whole chunks from the other end of the deque
+        for (size_t g = 0; g < groups.size(); g++)
+        {
+            const BatchGroup &group = groups[g];
+            for (size_t begin = 0; begin < group.jobIndices.size(); begin += kBatchChunkSize)
+            {
+                size_t end = std::min(begin + kBatchChunkSize, group.jobIndices.size());
+                workers.submit([&state, &group, begin, end](int32_t)
+                               { compileBatchChunk(state, group, begin, end); },
+                               static_cast<int32_t>(g % threadCount));
+            }
+        }
+        workers.wait();
+    }
+
+    // Tear down what each global session created while holding that global session
+    for (auto &context : state.contexts)
+    {
+        acquireSpecificGlobalSession(state.pool, context.first);
+        releaseCompileSessionContext(context.second);
+        slangc_returnGlobalSession(state.pool, context.first);
+    }
+
+    if (!desc->pool)
+        slangc_releaseSessionPool(state.pool);
+
+    int32_t failedCount = 0;
+    for (int32_t i = 0; i < jobCount; i++)
+    {
+        if (outResults[i].result != SLANGC_OK)
+            failedCount++;
+    }
+
+    clearError();
+    if (failedCount > 0)
+    {
+        setError(std::to_string(failedCount) + " of " + std::to_string(jobCount) + " batch jobs failed");
+        return invalidJobCount == failedCount ? SLANGC_E_INVALID_ARG : SLANGC_FAIL;
+    }
+    return SLANGC_OK;
+}
+
+void slangc_releaseCompileJobResults(SlangcCompileJobResult *results, int32_t resultCount)
+{
+    if (!results)
+        return;
+
+    for (int32_t i = 0; i < resultCount; i++)
+    {
+        slangc_releaseBlob(results[i].code);
+        slangc_releaseBlob(results[i].diagnostics);
+        results[i].code = nullptr;
+        results[i].diagnostics = nullptr;
+    }
+}
+
+//
+// Permutations
+//
+
+SlangcResult slangc_compilePermutations(
+    const SlangcPermutationDesc *desc,
+    const SlangcBatchDesc *batchDesc,
+    SlangcPermutationResults *outResults)
+{
+    clearError();
+    if (outResults)
+        *outResults = {};
+
+    if (!desc || !batchDesc || !outResults || !desc->moduleName || !desc->entryPointName ||
+        desc->dimensionCount < 0 || (desc->dimensionCount > 0 && !desc->dimensions) ||
+        desc->preprocessorMacroCount < 0 || (desc->preprocessorMacroCount > 0 && !desc->preprocessorMacros))
+    {
+        setError("Invalid parameters for permutation compile");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    const int32_t dimensionCount = desc->dimensionCount;
+    uint64_t totalCount = 1;
+    for (int32_t d = 0; d < dimensionCount; d++)
+    {
+        const SlangcMacroDimension &dimension = desc->dimensions[d];
+        if (!dimension.name || dimension.valueCount <= 0 || !dimension.values)
+        {
+            setError("Invalid macro dimension at index " + std::to_string(d));
+            return SLANGC_E_INVALID_ARG;
+        }
+        totalCount *= static_cast<uint64_t>(dimension.valueCount);
+        if (totalCount > static_cast<uint64_t>(INT32_MAX))
+        {
+            setError("Too many permutation variants");
+            return SLANGC_E_INVALID_ARG;
+        }
+    }
+
+    // Enumerate variants like an odometer, with the last dimension varying fastest
+    std::vector<int32_t> valueIndices;
+    std::vector<int32_t> current(dimensionCount, 0);
+    int32_t variantCount = 0;
+    for (uint64_t v = 0; v < totalCount; v++)
+    {
+        if (!desc->filter || desc->filter(current.data(), dimensionCount, desc->filterUserData))
+        {
+            valueIndices.insert(valueIndices.end(), current.begin(), current.end());
+            variantCount++;
+        }
+
+        for (int32_t d = dimensionCount - 1; d >= 0; d--)
+        {
+            if (++current[d] < desc->dimensions[d].valueCount)
+                break;
+            current[d] = 0;
+        }
+    }
+
+    // A dimension owns its macro, so shared definitions of the same name are dropped;
+    // otherwise a NULL value would still leave the shared definition in place
+    std::vector<const char *> sharedMacros;
+    for (int32_t i = 0; i < desc->preprocessorMacroCount; i++)
+    {
+        const char *macro = desc->preprocessorMacros[i];
+        if (!macro)
+            continue;
+        const char *equals = std::strchr(macro, '=');
+        std::string name = equals ? std::string(macro, equals) : std::string(macro);
+        bool ownedByDimension = false;
+        for (int32_t d = 0; d < dimensionCount && !ownedByDimension; d++)
+            ownedByDimension = name == desc->dimensions[d].name;
+        if (!ownedByDimension)
+            sharedMacros.push_back(macro);
+    }
+
+    // Build one batch job per variant
+    std::vector<std::vector<std::string>> macroStrings(variantCount);
+    std::vector<std::vector<const char *>> macroPointers(variantCount);
+    std::vector<SlangcCompileJob> jobs(variantCount);
+    for (int32_t v = 0; v < variantCount; v++)
+    {
+        std::vector<std::string> &strings = macroStrings[v];
+        strings.assign(sharedMacros.begin(), sharedMacros.end());
+        for (int32_t d = 0; d < dimensionCount; d++)
+        {
+            const SlangcMacroDimension &dimension = desc->dimensions[d];
+            const char *value = dimension.values[valueIndices[v * dimensionCount + d]];
+            if (value)
+                strings.push_back(std::string(dimension.name) + "=" + value);
+        }
+
+        for (const std::string &macro : strings)
+            macroPointers[v].push_back(macro.c_str());
+
+        SlangcCompileJob &job = jobs[v];
+        job.moduleName = desc->moduleName;
+        job.entryPointName = desc->entryPointName;
+        job.stage = desc->stage;
+        job.target = desc->target;
+        job.preprocessorMacros = macroPointers[v].empty() ? nullptr : macroPointers[v].data();
+        job.preprocessorMacroCount = static_cast<int32_t>(macroPointers[v].size());
+    }
+
+    std::vector<SlangcCompileJobResult> jobResults(variantCount);
+    SlangcResult result = slangc_compileBatch(batchDesc, jobs.data(), variantCount, jobResults.data());
+    std::string batchError = result == SLANGC_OK ? std::string() : slangc_getLastError();
+    if (variantCount == 0 && result != SLANGC_OK)
+        return result;
+
+    outResults->variantCount = variantCount;
+    outResults->dimensionCount = dimensionCount;
+    outResults->valueIndices = new int32_t[valueIndices.size()];
+    std::copy(valueIndices.begin(), valueIndices.end(), outResults->valueIndices);
+    outResults->results = new SlangcResult[variantCount];
+    outResults->blobIndices = new int32_t[variantCount];
+    outResults->diagnostics = new SlangcBlob *[variantCount];
+
+    // Keep the first blob with each content; later identical blobs are released
+    std::vector<SlangcBlob *> blobs;
+    std::unordered_map<uint64_t, std::vector<int32_t>> blobsByHash;
+    for (int32_t v = 0; v < variantCount; v++)
+    {
+        SlangcCompileJobResult &jobResult = jobResults[v];
+        outResults->results[v] = jobResult.result;
+        outResults->diagnostics[v] = jobResult.diagnostics;
+        outResults->blobIndices[v] = -1;
+        if (!jobResult.code)
+            continue;
+
+        const void *data = slangc_getBlobData(jobResult.code);
+        size_t size = slangc_getBlobSize(jobResult.code);
+        std::vector<int32_t> &candidates = blobsByHash[hashBytes(data, size)];
+        for (int32_t candidate : candidates)
+        {
+            SlangcBlob *blob = blobs[candidate];
+            if (slangc_getBlobSize(blob) == size && std::memcmp(slangc_getBlobData(blob), data, size) == 0)
+            {
+                outResults->blobIndices[v] = candidate;
+                break;
+            }
+        }
+
+        if (outResults->blobIndices[v] >= 0)
+        {
+            slangc_releaseBlob(jobResult.code);
+        }
+        else
+        {
+            outResults->blobIndices[v] = static_cast<int32_t>(blobs.size());
+            candidates.push_back(outResults->blobIndices[v]);
+            blobs.push_back(jobResult.code);
+        }
+        jobResult.code = nullptr;
+    }
+
+    outResults->blobCount = static_cast<int32_t>(blobs.size());
+    outResults->blobs = new SlangcBlob *[blobs.size()];
+    std::copy(blobs.begin(), blobs.end(), outResults->blobs);
+
+    clearError();
+    if (result != SLANGC_OK)
+        setError(batchError);
+    return result;
+}
+
+void slangc_releasePermutationResults(SlangcPermutationResults *results)
+{
+    if (!results)
+        return;
+
+    for (int32_t i = 0; results->diagnostics && i < results->variantCount; i++)
+        slangc_releaseBlob(results->diagnostics[i]);
+    for (int32_t i = 0; results->blobs && i < results->blobCount; i++)
+        slangc_releaseBlob(results->blobs[i]);
+
+    delete[] results->valueIndices;
+    delete[] results->results;
+    delete[] results->blobIndices;
+    delete[] results->diagnostics;
+    delete[] results->blobs;
+    *results = {};
+}
+
+//
+// Asynchronous Compilation
+//
+
+// A queued or finished asynchronous compile. Reference counted: the caller holds one
+// reference and the executor holds one per queue entry.
+struct SlangcCompileTicket
+{
+    std::atomic<uint32_t> refCount{1};
+    std::atomic<SlangcCompileTicketStatus> status{SLANGC_COMPILE_TICKET_PENDING};
+    std::mutex mutex;
+    std::condition_variable finished;
+
+    // Guarded by the executor mutex
+    int32_t priority = 0;
+    uint64_t queueVersion = 0;
+
+    // Owned copy of the job
+    std::string moduleName;
+    std::string entryPointName;
+    std::vector<std::string> macros;
+    std::vector<const char *> macroPointers;
+    std::string depfilePath;
+    std::string outputPath;
+    SlangcCompileJob job = {};
+
+    SlangcCompileJobResult result = {}; // Guarded by mutex
+    SlangcCompileCallback callback = nullptr;
+
+    // Set before the ticket finishes, so they are stable once it has
+    std::chrono::steady_clock::time_point submitTime;
+    std::chrono::steady_clock::time_point startTime;
+    std::chrono::steady_clock::time_point endTime;
+    void *userData = nullptr;
+    SlangcCompileExecutor *executor = nullptr;
+};
+
+namespace
+{
+    struct CompileQueueEntry
+    {
+        int32_t priority;
+        uint64_t sequence;
+        uint64_t version;
+        SlangcCompileTicket *ticket;
+    };
+
+    // Highest priority first, then first come first served
+    struct CompileQueueOrder
+    {
+        bool operator()(const CompileQueueEntry &a, const CompileQueueEntry &b) const
+        {
+            if (a.priority != b.priority)
+                return a.priority < b.priority;
+            return a.sequence > b.sequence;
+        }
+    };
+
+    void releaseCompileTicketReference(SlangcCompileTicket *ticket)
+    {
+        if (--ticket->refCount == 0)
+        {
+            slangc_releaseCompileJobResults(&ticket->result, 1);
+            delete ticket;
+        }
+    }
+
+    bool isCompileTicketFinished(SlangcCompileTicketStatus status)
+    {
+        return status == SLANGC_COMPILE_TICKET_SUCCEEDED ||
+               status == SLANGC_COMPILE_TICKET_FAILED ||
+               status == SLANGC_COMPILE_TICKET_CANCELLED;
+    }
+
+    void notifyCompileTicketWaiters(SlangcCompileTicket *ticket)
+    {
+        // Taking the lock orders the notify after any waiter's predicate check
+        {
+            std::lock_guard<std::mutex> lock(ticket->mutex);
+        }
+        ticket->finished.notify_all();
+    }
+}
+
+struct SlangcCompileExecutor
+{
+    CompileSettings settings;
+    std::vector<std::string> searchPaths;
+    std::vector<const char *> searchPathPointers;
+    SlangcSessionPool *pool = nullptr;
+    bool ownsPool = false;
+
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::priority_queue<CompileQueueEntry, std::vector<CompileQueueEntry>, CompileQueueOrder> queue;
+    uint64_t nextSequence = 0;
+    bool stop = false;
+
+    std::mutex contextMutex;
+    std::unordered_map<SlangcGlobalSession *, CompileSessionContext> contexts;
+
+    std::vector<std::thread> threads;
+};
+
+namespace
+{
+    void runCompileTicket(SlangcCompileExecutor *executor, SlangcCompileTicket *ticket)
+    {
+        ticket->startTime = std::chrono::steady_clock::now();
+        SlangcCompileJobResult result = {};
+
+        SlangcGlobalSession *globalSession = slangc_acquireGlobalSession(executor->pool);
+        if (!globalSession)
+        {
+            failCompileJob(result, SLANGC_FAIL, "");
+        }
+        else
+        {
+            CompileSessionContext *context;
+            {
+                std::lock_guard<std::mutex> lock(executor->contextMutex);
+                context = &executor->contexts[globalSession];
+            }
+
+            // Sessions hold a single target, so they are keyed by macro set and target
+            SlangcCompileTarget target = ticket->job.target;
+            std::string sessionKey = makeMacroKey(ticket->job.preprocessorMacros, ticket->job.preprocessorMacroCount) + '\0' + std::to_string(static_cast<int>(target));
+
+            SlangcSession *session = nullptr;
+            const std::string *moduleDiagnostics = nullptr;
+            SlangcModule *module = prepareCompileModule(
+                *context,
+                globalSession,
+                executor->settings,
+                sessionKey,
+                &target,
+                1,
+                ticket->job,
+                session,
+                moduleDiagnostics);
+
+            if (module)
+                compileJob(session, module, ticket->job, 0, *moduleDiagnostics, result);
+            else
+                failCompileJob(result, SLANGC_FAIL, *moduleDiagnostics);
+
+            slangc_returnGlobalSession(executor->pool, globalSession);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(ticket->mutex);
+            ticket->endTime = std::chrono::steady_clock::now();
+            ticket->result = result;
+            ticket->status = result.result == SLANGC_OK ? SLANGC_COMPILE_TICKET_SUCCEEDED : SLANGC_COMPILE_TICKET_FAILED;
+        }
+        ticket->finished.notify_all();
+    }
+
+    void runCompileExecutorWorker(SlangcCompileExecutor *executor)
+    {
+        for (;;)
+        {
+            CompileQueueEntry entry;
+            bool started;
+            {
+                std::unique_lock<std::mutex> lock(executor->mutex);
+                executor->workAvailable.wait(lock, [executor]
+                                             { return executor->stop || !executor->queue.empty(); });
+                if (executor->stop)
+                    return;
+
+                entry = executor->queue.top();
+                executor->queue.pop();
+                if (entry.version != entry.ticket->queueVersion)
+                {
+                    // Superseded by a priority change
+                    lock.unlock();
+                    releaseCompileTicketReference(entry.ticket);
+                    continue;
+                }
+
+                // Start the ticket under the lock, so a priority change can no longer queue
+                // another entry for it, and retire any entry that is already queued
+                entry.ticket->queueVersion++;
+                SlangcCompileTicketStatus expected = SLANGC_COMPILE_TICKET_PENDING;
+                started = entry.ticket->status.compare_exchange_strong(expected, SLANGC_COMPILE_TICKET_RUNNING);
+            }
+
+            SlangcCompileTicket *ticket = entry.ticket;
+            if (started)
+                runCompileTicket(executor, ticket);
+
+            // This is the ticket's only live entry, so the callback runs exactly once; it runs
+            // for cancelled tickets too, so callers can always free their user data
+            if (ticket->callback)
+                ticket->callback(ticket, ticket->userData);
+            releaseCompileTicketReference(ticket);
+        }
+    }
+}
+
+SlangcCompileExecutor *slangc_createCompileExecutor(const SlangcCompileExecutorDesc *desc)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    auto executor = std::make_unique<SlangcCompileExecutor>();
+
+    int32_t threadCount = desc ? desc->threadCount : 0;
+    if (threadCount <= 0)
+    {
+        // Leave a hardware thread for the caller's own work
+        threadCount = std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()) - 1);
+    }
+
+    if (desc)
+    {
+        for (int32_t i = 0; i < desc->searchPathCount; i++)
+            executor->searchPaths.push_back(desc->searchPaths && desc->searchPaths[i] ? desc->searchPaths[i] : "");
+        executor->settings.matrixLayoutMode = desc->matrixLayoutMode;
+        executor->settings.cache = desc->cache;
+        executor->settings.fileSystem = desc->fileSystem;
+        executor->settings.timingProfile = desc->timingProfile;
+    }
+    executor->settings.checkSourceChanges = true;
+    for (const auto &path : executor->searchPaths)
+        executor->searchPathPointers.push_back(path.c_str());
+    executor->settings.searchPaths = executor->searchPathPointers.data();
+    executor->settings.searchPathCount = static_cast<int32_t>(executor->searchPathPointers.size());
+
+    executor->pool = desc ? desc->pool : nullptr;
+    if (!executor->pool)
+    {
+        SlangcSessionPoolDesc poolDesc = {};
+        poolDesc.maxGlobalSessions = threadCount;
+        executor->pool = slangc_createSessionPool(&poolDesc);
+        if (!executor->pool)
+            return nullptr;
+        executor->ownsPool = true;
+    }
+
+    for (int32_t i = 0; i < threadCount; i++)
+    {
+        SlangcCompileExecutor *self = executor.get();
+        executor->threads.emplace_back([self]
+                                       { runCompileExecutorWorker(self); });
+    }
+
+    return executor.release();
+}
+
+void slangc_releaseCompileExecutor(SlangcCompileExecutor *executor)
+{
+    if (!executor)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(executor->mutex);
+        executor->stop = true;
+    }
+    executor->workAvailable.notify_all();
+    for (auto &thread : executor->threads)
+        thread.join();
+
+    // Cancel whatever never started
+    while (!executor->queue.empty())
+    {
+        CompileQueueEntry entry = executor->queue.top();
+        executor->queue.pop();
+
+        SlangcCompileTicket *ticket = entry.ticket;
+        if (entry.version == ticket->queueVersion)
+        {
+            SlangcCompileTicketStatus expected = SLANGC_COMPILE_TICKET_PENDING;
+            if (ticket->status.compare_exchange_strong(expected, SLANGC_COMPILE_TICKET_CANCELLED))
+                notifyCompileTicketWaiters(ticket);
+            if (ticket->callback)
+                ticket->callback(ticket, ticket->userData);
+        }
+        releaseCompileTicketReference(ticket);
+    }
+
+    for (auto &context : executor->contexts)
+    {
+        acquireSpecificGlobalSession(executor->pool, context.first);
+        releaseCompileSessionContext(context.second);
+        slangc_returnGlobalSession(executor->pool, context.first);
+    }
+
+    if (executor->ownsPool)
+        slangc_releaseSessionPool(executor->pool);
+
+    delete executor;
+}
+
+SlangcCompileTicket *slangc_compileAsync(
+    SlangcCompileExecutor *executor,
+    const SlangcCompileJob *job,
+    int32_t priority,
+    SlangcCompileCallback callback,
+    void *userData)
+{
+    clearError();
+    if (!executor || !job || !job->moduleName || !job->entryPointName)
+    {
+        setError("Invalid executor or compile job");
+        return nullptr;
+    }
+
+    auto ticket = std::make_unique<SlangcCompileTicket>();
+    ticket->moduleName = job->moduleName;
+    ticket->entryPointName = job->entryPointName;
+    for (int32_t i = 0; i < job->preprocessorMacroCount; i++)
+        ticket->macros.push_back(job->preprocessorMacros && job->preprocessorMacros[i] ? job->preprocessorMacros[i] : "");
+    for (const auto &macro : ticket->macros)
+        ticket->macroPointers.push_back(macro.c_str());
+
+    ticket->job = *job;
+    ticket->job.moduleName = ticket->moduleName.c_str();
+    ticket->job.entryPointName = ticket->entryPointName.c_str();
+    ticket->job.preprocessorMacros = ticket->macroPointers.data();
+    ticket->job.preprocessorMacroCount = static_cast<int32_t>(ticket->macroPointers.size());
+    if (job->depfilePath)
+    {
+        ticket->depfilePath = job->depfilePath;
+        ticket->job.depfilePath = ticket->depfilePath.c_str();
+    }
+    if (job->outputPath)
+    {
+        ticket->outputPath = job->outputPath;
+        ticket->job.outputPath = ticket->outputPath.c_str();
+    }
+    ticket->callback = callback;
+    ticket->userData = userData;
+    ticket->executor = executor;
+    ticket->priority = priority;
+    ticket->submitTime = std::chrono::steady_clock::now();
+
+    SlangcCompileTicket *result = ticket.release();
+    result->refCount++; // Reference held by the queue entry
+    {
+        std::lock_guard<std::mutex> lock(executor->mutex);
+        executor->queue.push({priority, executor->nextSequence++, result->queueVersion, result});
+    }
+    executor->workAvailable.notify_one();
+    return result;
+}
+
+SlangcCompileTicketStatus slangc_pollCompileTicket(SlangcCompileTicket *ticket)
+{
+    if (!ticket)
+        return SLANGC_COMPILE_TICKET_FAILED;
+    return ticket->status.load();
+}
+
+SlangcCompileTicketStatus slangc_waitCompileTicket(SlangcCompileTicket *ticket, uint32_t timeoutMilliseconds)
+{
+    if (!ticket)
+        return SLANGC_COMPILE_TICKET_FAILED;
+
+    std::unique_lock<std::mutex> lock(ticket->mutex);
+    auto isFinished = [ticket]
+    { return isCompileTicketFinished(ticket->status.load()); };
+    if (timeoutMilliseconds == SLANGC_WAIT_INFINITE)
+        ticket->finished.wait(lock, isFinished);
+    else
+        ticket->finished.wait_for(lock, std::chrono::milliseconds(timeoutMilliseconds), isFinished);
+    return ticket->status.load();
+}
+
+bool slangc_cancelCompileTicket(SlangcCompileTicket *ticket)
+{
+    if (!ticket)
+        return false;
+
+    SlangcCompileTicketStatus expected = SLANGC_COMPILE_TICKET_PENDING;
+    if (!ticket->status.compare_exchange_strong(expected, SLANGC_COMPILE_TICKET_CANCELLED))
+        return false;
+
+    notifyCompileTicketWaiters(ticket);
+    return true;
+}
+
+SlangcResult slangc_setCompileTicketPriority(SlangcCompileTicket *ticket, int32_t priority)
+{
+    if (!ticket)
+        return SLANGC_E_INVALID_ARG;
+
+    // Releasing the executor finishes or cancels every ticket, so a pending ticket's
+    // executor is still alive; a ticket kept past the release must not touch it
+    if (ticket->status.load() != SLANGC_COMPILE_TICKET_PENDING)
+        return SLANGC_FAIL;
+
+    SlangcCompileExecutor *executor = ticket->executor;
+    {
+        std::lock_guard<std::mutex> lock(executor->mutex);
+        if (ticket->status.load() != SLANGC_COMPILE_TICKET_PENDING || executor->stop)
+            return SLANGC_FAIL;
+
+        // Queue a new entry; the old one is skipped when it reaches the front
+        ticket->priority = priority;
+        ticket->queueVersion++;
+        ticket->refCount++;
+        executor->queue.push({priority, executor->nextSequence++, ticket->queueVersion, ticket});
+    }
+    executor->workAvailable.notify_one();
+    return SLANGC_OK;
+}
+
+SlangcResult slangc_takeCompileTicketResult(SlangcCompileTicket *ticket, SlangcCompileJobResult *outResult)
+{
+    if (!ticket || !outResult)
+        return SLANGC_E_INVALID_ARG;
+
+    std::lock_guard<std::mutex> lock(ticket->mutex);
+    if (!isCompileTicketFinished(ticket->status.load()))
+        return SLANGC_FAIL;
+
+    if (ticket->status.load() == SLANGC_COMPILE_TICKET_CANCELLED)
+    {
+        *outResult = {};
+        outResult->result = SLANGC_FAIL;
+        return SLANGC_OK;
+    }
+
+    *outResult = ticket->result;
+    ticket->result.code = nullptr;
+    ticket->result.diagnostics = nullptr;
+    return SLANGC_OK;
+}
+
+SlangcResult slangc_getCompileTicketTiming(
+    SlangcCompileTicket *ticket,
+    double *outQueuedMilliseconds,
+    double *outRunMilliseconds)
+{
+    if (!ticket)
+        return SLANGC_E_INVALID_ARG;
+
+    std::lock_guard<std::mutex> lock(ticket->mutex);
+    SlangcCompileTicketStatus status = ticket->status.load();
+    if (!isCompileTicketFinished(status) || status == SLANGC_COMPILE_TICKET_CANCELLED)
+        return SLANGC_FAIL;
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    if (outQueuedMilliseconds)
+        *outQueuedMilliseconds = Milliseconds(ticket->startTime - ticket->submitTime).count();
+    if (outRunMilliseconds)
+        *outRunMilliseconds = Milliseconds(ticket->endTime - ticket->startTime).count();
+    return SLANGC_OK;
+}
+
+void slangc_releaseCompileTicket(SlangcCompileTicket *ticket)
+{
+    if (ticket)
+        releaseCompileTicketReference(ticket);
+}
+
+//
+// Compile Server
+//
+
+#ifndef _WIN32
+
+namespace
+{
+    const uint32_t kServerProtocolMagic = 0x53434C53u; // "SLCS"
+    const uint32_t kServerProtocolVersion = 1;
+    const uint32_t kMaxServerFrameSize = 1u << 30;
+    const int kServerReplyTimeoutMilliseconds = 30000; // Longest silence before a client compiles in process
+    const int32_t kDefaultMaxServerExecutors = 4;
+
+    // A batch as sent to the server, with every path made absolute by the client
+    struct ServerRequest
+    {
+        uint32_t matrixLayoutMode = 0;
+        std::vector<std::string> searchPaths;
+
+        struct Job
+        {
+            std::string moduleName;
+            std::string entryPointName;
+            uint32_t stage = 0;
+            uint32_t target = 0;
+            std::vector<std::string> macros;
+            std::string depfilePath;
+            std::string outputPath;
+        };
+        std::vector<Job> jobs;
+    };
+
+    void encodeServerRequest(const ServerRequest &request, std::vector<uint8_t> &out)
+    {
+        appendCacheU32(out, kServerProtocolMagic);
+        appendCacheU32(out, kServerProtocolVersion);
+        appendCacheU32(out, request.matrixLayoutMode);
+        appendCacheStrings(out, request.searchPaths);
+        appendCacheU32(out, static_cast<uint32_t>(request.jobs.size()));
+        for (const auto &job : request.jobs)
+        {
+            appendCacheString(out, job.moduleName);
+            appendCacheString(out, job.entryPointName);
+            appendCacheU32(out, job.stage);
+            appendCacheU32(out, job.target);
+            appendCacheStrings(out, job.macros);
+            appendCacheString(out, job.depfilePath);
+            appendCacheString(out, job.outputPath);
+        }
+    }
+
+    bool decodeServerRequest(const std::vector<uint8_t> &payload, ServerRequest &outRequest)
+    {
+        const uint8_t *data = payload.data();
+        const uint8_t *end = data + payload.size();
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t jobCount = 0;
+        if (!readCacheU32(data, end, magic) || magic != kServerProtocolMagic ||
+            !readCacheU32(data, end, version) || version != kServerProtocolVersion ||
+            !readCacheU32(data, end, outRequest.matrixLayoutMode) ||
+            !readCacheStrings(data, end, outRequest.searchPaths) ||
+            !readCacheU32(data, end, jobCount))
+            return false;
+
+        for (uint32_t i = 0; i < jobCount; i++)
+        {
+            ServerRequest::Job job;
+            if (!readCacheString(data, end, job.moduleName) ||
+                !readCacheString(data, end, job.entryPointName) ||
+                !readCacheU32(data, end, job.stage) ||
+                !readCacheU32(data, end, job.target) ||
+                !readCacheStrings(data, end, job.macros) ||
+                !readCacheString(data, end, job.depfilePath) ||
+                !readCacheString(data, end, job.outputPath))
+                return false;
+            outRequest.jobs.push_back(std::move(job));
+        }
+        return data == end;
+    }
+
+    // Each result goes back in its own frame as soon as its job finishes
+    void encodeServerResult(uint32_t jobIndex, const SlangcCompileJobResult &result, std::vector<uint8_t> &out)
+    {
+        std::string diagnostics;
+        if (result.diagnostics)
+        {
+            auto data = static_cast<const char *>(slangc_getBlobData(result.diagnostics));
+            diagnostics.assign(data, strnlen(data, slangc_getBlobSize(result.diagnostics)));
+        }
+
+        appendCacheU32(out, jobIndex);
+        appendCacheU32(out, static_cast<uint32_t>(result.result));
+        appendCacheString(out, diagnostics);
+
+        size_t codeSize = result.code ? slangc_getBlobSize(result.code) : 0;
+        appendCacheU32(out, static_cast<uint32_t>(codeSize));
+        if (codeSize > 0)
+        {
+            auto code = static_cast<const uint8_t *>(slangc_getBlobData(result.code));
+            out.insert(out.end(), code, code + codeSize);
+        }
+    }
+
+    bool decodeServerResult(const std::vector<uint8_t> &payload, uint32_t &outJobIndex, SlangcCompileJobResult &outResult)
+    {
+        const uint8_t *data = payload.data();
+        const uint8_t *end = data + payload.size();
+        uint32_t result = 0;
+        std::string diagnostics;
+        uint32_t codeSize = 0;
+        if (!readCacheU32(data, end, outJobIndex) ||
+            !readCacheU32(data, end, result) ||
+            !readCacheString(data, end, diagnostics) ||
+            !readCacheU32(data, end, codeSize) ||
+            static_cast<size_t>(end - data) != codeSize)
+            return false;
+
+        outResult.result = static_cast<SlangcResult>(result);
+        outResult.diagnostics = createTextBlob(diagnostics);
+        outResult.code = nullptr;
+        if (codeSize > 0)
+        {
+            auto wrapper = std::make_unique<SlangcBlob>();
+            wrapper->blob = new OwnedBlob(std::vector<uint8_t>(data, end));
+            outResult.code = wrapper.release();
+        }
+        return true;
+    }
+
+    std::string makeServerSettingsKey(const ServerRequest &request)
+    {
+        std::string key = std::to_string(request.matrixLayoutMode);
+        for (const std::string &path : request.searchPaths)
+            key += '\0' + path;
+        return key;
+    }
+
+    // SLANGC_SERVER_SOCKET, then the per-user runtime directory, then a per-user directory in /tmp
+    std::string getDefaultServerSocketPath()
+    {
+        if (const char *path = std::getenv("SLANGC_SERVER_SOCKET"))
+            return path;
+        if (const char *runtimeDirectory = std::getenv("XDG_RUNTIME_DIR"))
+            return std::string(runtimeDirectory) + "/slangc-server.sock";
+        return "/tmp/slangc-" + std::to_string(getuid()) + "/server.sock";
+    }
+
+    // The socket must sit in a directory only this user can change, so nobody else can
+    // replace it, and a socket already there must belong to this user. The server
+    // creates a missing directory with mode 0700.
+    bool checkServerSocketPath(const std::string &path, bool createDirectory, std::string &outError)
+    {
+        std::string directory = std::filesystem::path(path).parent_path().string();
+        if (directory.empty())
+            directory = ".";
+        if (createDirectory && mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST)
+        {
+            outError = "Failed to create " + directory + ": " + std::strerror(errno);
+            return false;
+        }
+
+        struct stat info = {};
+        if (lstat(directory.c_str(), &info) != 0 || !S_ISDIR(info.st_mode) || info.st_uid != getuid() ||
+            (info.st_mode & (S_IWGRP | S_IWOTH)) != 0)
+        {
+            outError = "Compile server socket directory " + directory +
+                       " must be a directory owned by the current user and writable only by them";
+            return false;
+        }
+
+        if (lstat(path.c_str(), &info) == 0 && (!S_ISSOCK(info.st_mode) || info.st_uid != getuid()))
+        {
+            outError = "Compile server socket " + path + " exists and is not a socket owned by the current user";
+            return false;
+        }
+        return true;
+    }
+
+    // Both ends only talk to processes of the same user
+    bool isPeerCurrentUser(int fd)
+    {
+#ifdef SO_PEERCRED
+        ucred credentials = {};
+        socklen_t size = sizeof(credentials);
+        if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &size) != 0)
+            return false;
+        return credentials.uid == getuid();
+#else
+        uid_t uid = 0;
+        gid_t gid = 0;
+        if (getpeereid(fd, &uid, &gid) != 0)
+            return false;
+        return uid == getuid();
+#endif
+    }
+
+#ifdef MSG_NOSIGNAL
+    const int kSendFlags = MSG_NOSIGNAL;
+#else
+    const int kSendFlags = 0;
+#endif
+
+    bool sendAll(int fd, const uint8_t *data, size_t size)
+    {
+        while (size > 0)
+        {
+            ssize_t sent = send(fd, data, size, kSendFlags);
+            if (sent < 0 && errno == EINTR)
+                continue;
+            if (sent <= 0)
+                return false;
+            data += sent;
+            size -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+
+    // With a timeout (-1 for none), gives up once no data arrives for that long
+    bool receiveAll(int fd, uint8_t *data, size_t size, int timeoutMilliseconds)
+    {
+        while (size > 0)
+        {
+            if (timeoutMilliseconds >= 0)
+            {
+                pollfd readable = {fd, POLLIN, 0};
+                int ready = poll(&readable, 1, timeoutMilliseconds);
+                if (ready < 0 && errno == EINTR)
+                    continue;
+                if (ready <= 0)
+                    return false;
+            }
+
+            ssize_t received = recv(fd, data, size, 0);
+            if (received < 0 && errno == EINTR)
+                continue;
+            if (received <= 0)
+                return false;
+            data += received;
+            size -= static_cast<size_t>(received);
+        }
+        return true;
+    }
+
+    // Frames are a u32 payload size followed by the payload
+    bool sendFrame(int fd, const std::vector<uint8_t> &payload)
+    {
+        uint32_t size = static_cast<uint32_t>(payload.size());
+        return sendAll(fd, reinterpret_cast<const uint8_t *>(&size), sizeof(size)) &&
+               sendAll(fd, payload.data(), payload.size());
+    }
+
+    bool receiveFrame(int fd, std::vector<uint8_t> &outPayload, int timeoutMilliseconds)
+    {
+        uint32_t size = 0;
+        if (!receiveAll(fd, reinterpret_cast<uint8_t *>(&size), sizeof(size), timeoutMilliseconds) || size > kMaxServerFrameSize)
+            return false;
+        outPayload.resize(size);
+        return receiveAll(fd, outPayload.data(), size, timeoutMilliseconds);
+    }
+
+    bool makeSocketAddress(const std::string &path, sockaddr_un &outAddress)
+    {
+        outAddress = {};
+        outAddress.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(outAddress.sun_path))
+            return false;
+        std::memcpy(outAddress.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    int createSocket()
+    {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+#ifdef SO_NOSIGPIPE
+        if (fd >= 0)
+        {
+            int enable = 1;
+            setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enable, sizeof(enable));
+        }
+#endif
+        return fd;
+    }
+
+    int connectCompileServer(const std::string &path)
+    {
+        sockaddr_un address;
+        std::string error;
+        if (!makeSocketAddress(path, address) || !checkServerSocketPath(path, false, error))
+            return -1;
+
+        int fd = createSocket();
+        if (fd < 0)
+            return -1;
+        if (connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 || !isPeerCurrentUser(fd))
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    std::string makeAbsolutePath(const char *path)
+    {
+        if (!path || !path[0])
+            return std::string();
+        std::error_code ec;
+        std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+        return ec ? std::string(path) : absolute.string();
+    }
+
+    // Module names with a directory or a .slang extension are file paths, tried against the
+    // working directory before the search paths. One that exists here is made absolute so
+    // the server finds the same file; any other is left for the search paths.
+    std::string makeServerModuleName(const char *moduleName)
+    {
+        if (!moduleName)
+            return std::string();
+        std::string name = moduleName;
+        bool isPath = name.find_first_of("/\\") != std::string::npos ||
+                      std::filesystem::path(name).extension() == ".slang";
+        std::error_code ec;
+        return isPath && std::filesystem::is_regular_file(name, ec) ? makeAbsolutePath(moduleName) : name;
+    }
+
+    // Sends a batch to the server and reads back every result. On failure, including a
+    // server that stays silent for kServerReplyTimeoutMilliseconds, the results received
+    // so far are released so the caller can compile in process instead.
+    bool forwardBatch(
+        int fd,
+        const SlangcBatchDesc *desc,
+        const SlangcCompileJob *jobs,
+        int32_t jobCount,
+        SlangcCompileJobResult *outResults)
+    {
+        ServerRequest request;
+        request.matrixLayoutMode = static_cast<uint32_t>(desc->matrixLayoutMode);
+        for (int32_t i = 0; i < desc->searchPathCount; i++)
+            request.searchPaths.push_back(makeAbsolutePath(desc->searchPaths ? desc->searchPaths[i] : nullptr));
+        for (int32_t i = 0; i < jobCount; i++)
+        {
+            const SlangcCompileJob &job = jobs[i];
+            ServerRequest::Job requestJob;
+            requestJob.moduleName = makeServerModuleName(job.moduleName);
+            requestJob.entryPointName = job.entryPointName ? job.entryPointName : "";
+            requestJob.stage = static_cast<uint32_t>(job.stage);
+            requestJob.target = static_cast<uint32_t>(job.target);
+            for (int32_t m = 0; m < job.preprocessorMacroCount; m++)
+            {
+                if (job.preprocessorMacros && job.preprocessorMacros[m])
+                    requestJob.macros.push_back(job.preprocessorMacros[m]);
+            }
+            requestJob.depfilePath = makeAbsolutePath(job.depfilePath);
+            requestJob.outputPath = job.outputPath ? job.outputPath : ""; // Depfile rule target, kept as written
+            request.jobs.push_back(std::move(requestJob));
+        }
+
+        std::vector<uint8_t> payload;
+        encodeServerRequest(request, payload);
+        if (!sendFrame(fd, payload))
+            return false;
+
+        std::fill(outResults, outResults + jobCount, SlangcCompileJobResult{});
+        std::vector<bool> received(jobCount, false);
+        for (int32_t i = 0; i < jobCount; i++)
+        {
+            uint32_t jobIndex = 0;
+            SlangcCompileJobResult result = {};
+            if (!receiveFrame(fd, payload, kServerReplyTimeoutMilliseconds) || !decodeServerResult(payload, jobIndex, result) ||
+                jobIndex >= static_cast<uint32_t>(jobCount) || received[jobIndex])
+            {
+                slangc_releaseCompileJobResults(&result, 1);
+                slangc_releaseCompileJobResults(outResults, jobCount);
+                std::fill(outResults, outResults + jobCount, SlangcCompileJobResult{});
+                return false;
+            }
+            received[jobIndex] = true;
+            outResults[jobIndex] = result;
+        }
+        return true;
+    }
+
+    // Completion of one job of a request, queued for the connection thread to send
+    struct ServerRequestState
+    {
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::vector<uint32_t> finishedJobs;
+    };
+
+    struct ServerJobRecord
+    {
+        ServerRequestState *state;
+        uint32_t jobIndex;
+    };
+
+    void onServerJobFinished(SlangcCompileTicket *, void *userData)
+    {
+        auto record = static_cast<ServerJobRecord *>(userData);
+        {
+            std::lock_guard<std::mutex> lock(record->state->mutex);
+            record->state->finishedJobs.push_back(record->jobIndex);
+        }
+        record->state->finished.notify_one();
+    }
+}
+
+struct SlangcCompileServer
+{
+    std::string socketPath;
+    int listenFd = -1;
+    int stopPipe[2] = {-1, -1};
+    std::atomic<bool> stop{false};
+
+    SlangcSessionPool *pool = nullptr;
+    bool ownsPool = false;
+    SlangcCache *cache = nullptr;
+    int32_t threadCount = 0;
+
+    // One warm executor per set of session settings, up to maxExecutors. Requests hold a
+    // reference, so an evicted executor is released once its last request is served.
+    struct ServerExecutor
+    {
+        std::shared_ptr<SlangcCompileExecutor> executor;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    std::mutex executorMutex;
+    int32_t maxExecutors = 0;
+    std::list<std::string> executorLru; // Most recently used settings key at the front
+    std::unordered_map<std::string, ServerExecutor> executors;
+
+    struct Connection
+    {
+        std::thread thread;
+        bool finished = false; // Guarded by connectionMutex
+    };
+
+    std::mutex connectionMutex;
+    std::unordered_map<int, std::unique_ptr<Connection>> connections; // Keyed by socket
+
+    std::atomic<uint64_t> requestCount{0};
+    std::atomic<uint64_t> jobCount{0};
+    std::atomic<uint64_t> rejectedConnectionCount{0};
+};
+
+namespace
+{
+    std::shared_ptr<SlangcCompileExecutor> getServerExecutor(SlangcCompileServer *server, const ServerRequest &request)
+    {
+        std::string key = makeServerSettingsKey(request);
+        std::vector<std::shared_ptr<SlangcCompileExecutor>> evicted; // Released after unlocking
+        std::lock_guard<std::mutex> lock(server->executorMutex);
+        auto found = server->executors.find(key);
+        if (found != server->executors.end())
+        {
+            server->executorLru.splice(server->executorLru.begin(), server->executorLru, found->second.lruPosition);
+            return found->second.executor;
+        }
+
+        std::shared_ptr<SlangcCompileExecutor> executor;
+        {
+            std::vector<const char *> searchPaths;
+            for (const std::string &path : request.searchPaths)
+                searchPaths.push_back(path.c_str());
+
+            SlangcCompileExecutorDesc executorDesc = {};
+            executorDesc.pool = server->pool;
+            executorDesc.threadCount = server->threadCount;
+            executorDesc.searchPaths = searchPaths.data();
+            executorDesc.searchPathCount = static_cast<int32_t>(searchPaths.size());
+            executorDesc.matrixLayoutMode = static_cast<SlangcMatrixLayoutMode>(request.matrixLayoutMode);
+            executorDesc.cache = server->cache;
+            SlangcCompileExecutor *created = slangc_createCompileExecutor(&executorDesc);
+            if (!created)
+                return nullptr;
+            executor.reset(created, slangc_releaseCompileExecutor);
+        }
+
+        while (static_cast<int32_t>(server->executors.size()) >= server->maxExecutors)
+        {
+            auto oldest = server->executors.find(server->executorLru.back());
+            evicted.push_back(std::move(oldest->second.executor));
+            server->executors.erase(oldest);
+            server->executorLru.pop_back();
+        }
+        server->executorLru.push_front(key);
+        server->executors[key] = {executor, server->executorLru.begin()};
+        return executor;
+    }
+
+    // Serves requests on one connection until the client disconnects
+    void serveCompileConnection(SlangcCompileServer *server, int fd)
+    {
+        std::vector<uint8_t> payload;
+        while (!server->stop && receiveFrame(fd, payload, -1))
+        {
+            ServerRequest request;
+            if (!decodeServerRequest(payload, request))
+                break;
+            server->requestCount++;
+            server->jobCount += request.jobs.size();
+
+            std::shared_ptr<SlangcCompileExecutor> executor = getServerExecutor(server, request);
+            size_t jobCount = request.jobs.size();
+            ServerRequestState state;
+            std::vector<ServerJobRecord> records(jobCount);
+            std::vector<SlangcCompileTicket *> tickets(jobCount, nullptr);
+            for (size_t i = 0; i < jobCount; i++)
+            {
+                const ServerRequest::Job &requestJob = request.jobs[i];
+                std::vector<const char *> macros;
+                for (const std::string &macro : requestJob.macros)
+                    macros.push_back(macro.c_str());
+
+                SlangcCompileJob job = {};
+                job.moduleName = requestJob.moduleName.c_str();
+                job.entryPointName = requestJob.entryPointName.c_str();
+                job.stage = static_cast<SlangcStage>(requestJob.stage);
+                job.target = static_cast<SlangcCompileTarget>(requestJob.target);
+                job.preprocessorMacros = macros.empty() ? nullptr : macros.data();
+                job.preprocessorMacroCount = static_cast<int32_t>(macros.size());
+                job.depfilePath = requestJob.depfilePath.empty() ? nullptr : requestJob.depfilePath.c_str();
+                job.outputPath = requestJob.outputPath.empty() ? nullptr : requestJob.outputPath.c_str();
+
+                records[i] = {&state, static_cast<uint32_t>(i)};
+                tickets[i] = executor ? slangc_compileAsync(executor.get(), &job, 0, onServerJobFinished, &records[i]) : nullptr;
+                if (!tickets[i])
+                {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    state.finishedJobs.push_back(static_cast<uint32_t>(i));
+                }
+            }
+
+            // Stream results back in completion order. Every callback must have run before
+            // the records go away, so a broken connection still waits for the rest.
+            bool connected = true;
+            for (size_t sent = 0; sent < jobCount; sent++)
+            {
+                uint32_t jobIndex;
+                {
+                    std::unique_lock<std::mutex> lock(state.mutex);
+                    state.finished.wait(lock, [&state]
+                                        { return !state.finishedJobs.empty(); });
+                    jobIndex = state.finishedJobs.back();
+                    state.finishedJobs.pop_back();
+                }
+
+                SlangcCompileJobResult result = {};
+                if (!tickets[jobIndex] || slangc_takeCompileTicketResult(tickets[jobIndex], &result) != SLANGC_OK)
+                    failCompileJob(result, SLANGC_FAIL, "error: the compile server could not run this job\n");
+                slangc_releaseCompileTicket(tickets[jobIndex]);
+
+                if (connected)
+                {
+                    payload.clear();
+                    encodeServerResult(jobIndex, result, payload);
+                    connected = sendFrame(fd, payload);
+                }
+                slangc_releaseCompileJobResults(&result, 1);
+            }
+            if (!connected)
+                break;
+        }
+
+        std::lock_guard<std::mutex> lock(server->connectionMutex);
+        server->connections[fd]->finished = true;
+    }
+
+    // Joins connection threads that have returned and closes their sockets
+    void reapCompileConnections(SlangcCompileServer *server, bool all)
+    {
+        std::vector<std::pair<int, std::unique_ptr<SlangcCompileServer::Connection>>> reaped;
+        {
+            std::lock_guard<std::mutex> lock(server->connectionMutex);
+            for (auto it = server->connections.begin(); it != server->connections.end();)
+            {
+                if (!all && !it->second->finished)
+                {
+                    ++it;
+                    continue;
+                }
+                reaped.emplace_back(it->first, std::move(it->second));
+                it = server->connections.erase(it);
+            }
+        }
+
+        for (auto &connection : reaped)
+        {
+            connection.second->thread.join();
+            close(connection.first);
+        }
+    }
+}
+
+SlangcCompileServer *slangc_createCompileServer(const SlangcCompileServerDesc *desc)
+{
+    clearError();
+    if (!isSlangAvailable())
+    {
+        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        return nullptr;
+    }
+
+    auto server = std::make_unique<SlangcCompileServer>();
+    server->socketPath = desc && desc->socketPath ? desc->socketPath : getDefaultServerSocketPath();
+    server->threadCount = desc && desc->threadCount > 0
+                              ? desc->threadCount
+                              : std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+    server->cache = desc ? desc->cache : nullptr;
+    server->maxExecutors = desc && desc->maxExecutors > 0 ? desc->maxExecutors : kDefaultMaxServerExecutors;
+
+    sockaddr_un address;
+    if (!makeSocketAddress(server->socketPath, address))
+    {
+        setError("Invalid compile server socket path: " + server->socketPath);
+        return nullptr;
+    }
+
+    std::string pathError;
+    if (!checkServerSocketPath(server->socketPath, true, pathError))
+    {
+        setError(pathError);
+        return nullptr;
+    }
+
+    // A socket file nobody answers on is left over from a server that did not exit cleanly
+    int running = connectCompileServer(server->socketPath);
+    if (running >= 0)
+    {
+        close(running);
+        setError("A compile server is already running on " + server->socketPath);
+        return nullptr;
+    }
+    unlink(server->socketPath.c_str());
+
+    // Nothing can connect before listen, so the mode is set before the first client
+    server->listenFd = createSocket();
+    if (server->listenFd < 0 ||
+        bind(server->listenFd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 ||
+        chmod(server->socketPath.c_str(), S_IRUSR | S_IWUSR) != 0 ||
+        listen(server->listenFd, SOMAXCONN) != 0 ||
+        pipe(server->stopPipe) != 0)
+    {
+        setError("Failed to listen on " + server->socketPath + ": " + std::strerror(errno));
+        if (server->listenFd >= 0)
+            close(server->listenFd);
+        unlink(server->socketPath.c_str());
+        return nullptr;
+    }
+
+    server->pool = desc ? desc->pool : nullptr;
+    if (!server->pool)
+    {
+        SlangcSessionPoolDesc poolDesc = {};
+        poolDesc.maxGlobalSessions = server->threadCount;
+        server->pool = slangc_createSessionPool(&poolDesc);
+        if (!server->pool)
+        {
+            close(server->listenFd);
+            close(server->stopPipe[0]);
+            close(server->stopPipe[1]);
+            unlink(server->socketPath.c_str());
+            return nullptr;
+        }
+        server->ownsPool = true;
+    }
+
+    return server.release();
+}
+
+SlangcResult slangc_runCompileServer(SlangcCompileServer *server)
+{
+    clearError();
+    if (!server)
+    {
+        setError("Invalid compile server");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    while (!server->stop)
+    {
+        pollfd fds[2] = {{server->listenFd, POLLIN, 0}, {server->stopPipe[0], POLLIN, 0}};
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (server->stop || (fds[1].revents & POLLIN))
+            break;
+        if (!(fds[0].revents & POLLIN))
+            continue;
+
+        reapCompileConnections(server, false);
+        int fd = accept(server->listenFd, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+        if (!isPeerCurrentUser(fd))
+        {
+            server->rejectedConnectionCount++;
+            close(fd);
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(server->connectionMutex);
+        auto &connection = server->connections[fd];
+        connection = std::make_unique<SlangcCompileServer::Connection>();
+        connection->thread = std::thread([server, fd]
+                                         { serveCompileConnection(server, fd); });
+    }
+
+    // Unblock connections waiting for their next request; compiles already queued finish
+    {
+        std::lock_guard<std::mutex> lock(server->connectionMutex);
+        for (auto &connection : server->connections)
+            shutdown(connection.first, SHUT_RDWR);
+    }
+    reapCompileConnections(server, true);
+    return SLANGC_OK;
+}
+
+void slangc_stopCompileServer(SlangcCompileServer *server)
+{
+    if (!server)
+        return;
+
+    server->stop = true;
+    char wake = 1;
+    ssize_t written = write(server->stopPipe[1], &wake, 1);
+    (void)written;
+}
+
+void slangc_releaseCompileServer(SlangcCompileServer *server)
+{
+    if (!server)
+        return;
+
+    server->executors.clear();
+    close(server->listenFd);
+    close(server->stopPipe[0]);
+    close(server->stopPipe[1]);
+    unlink(server->socketPath.c_str());
+    if (server->ownsPool)
+        slangc_releaseSessionPool(server->pool);
+    delete server;
+}
+
+SlangcResult slangc_getCompileServerStats(SlangcCompileServer *server, SlangcCompileServerStats *outStats)
+{
+    if (!server || !outStats)
+        return SLANGC_E_INVALID_ARG;
+
+    outStats->requestCount = server->requestCount;
+    outStats->jobCount = server->jobCount;
+    outStats->rejectedConnectionCount = server->rejectedConnectionCount;
+    return SLANGC_OK;
+}
+
+#else
+
+struct SlangcCompileServer
+{
+};
+
+SlangcCompileServer *slangc_createCompileServer(const SlangcCompileServerDesc *)
+{
+    clearError();
+    setError("The compile server needs Unix domain sockets and is not available on Windows");
+    return nullptr;
+}
+
+SlangcResult slangc_runCompileServer(SlangcCompileServer *)
+{
+    clearError();
+    setError("Invalid compile server");
+    return SLANGC_E_INVALID_ARG;
+}
+
+void slangc_stopCompileServer(SlangcCompileServer *)
+{
+}
+
+void slangc_releaseCompileServer(SlangcCompileServer *server)
+{
+    delete server;
+}
+
+SlangcResult slangc_getCompileServerStats(SlangcCompileServer *, SlangcCompileServerStats *)
+{
+    return SLANGC_E_INVALID_ARG;
+}
+
+#endif
+
+SlangcResult slangc_compileBatchRemote(
+    const char *socketPath,
+    const SlangcBatchDesc *desc,
+    const SlangcCompileJob *jobs,
+    int32_t jobCount,
+    SlangcCompileJobResult *outResults)
+{
+    clearError();
+    if (!desc || jobCount < 0 || (jobCount > 0 && (!jobs || !outResults)))
     {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
+        setError("Invalid parameters for batch compile");
+        return SLANGC_E_INVALID_ARG;
     }
 
-    if (!globalSession)
+#ifndef _WIN32
+    // File systems and timing profiles live in this process, so those batches stay here
+    if (!desc->fileSystem && !desc->timingProfile)
     {
-        setError("Invalid global session");
-        return nullptr;
+        int fd = connectCompileServer(socketPath ? socketPath : getDefaultServerSocketPath());
+        if (fd >= 0)
+        {
+            bool forwarded = forwardBatch(fd, desc, jobs, jobCount, outResults);
+            close(fd);
+            if (forwarded)
+            {
+                int32_t failedCount = 0;
+                for (int32_t i = 0; i < jobCount; i++)
+                {
+                    if (outResults[i].result != SLANGC_OK)
+                        failedCount++;
+                }
+                if (failedCount > 0)
+                {
+                    setError(std::to_string(failedCount) + " of " + std::to_string(jobCount) + " batch jobs failed");
+                    return SLANGC_FAIL;
+                }
+                return SLANGC_OK;
+            }
+        }
     }
+#else
+    (void)socketPath;
+#endif
+
+    return slangc_compileBatch(desc, jobs, jobCount, outResults);
+}
+
+//
+// Dependency Tracking
+//
 
-    auto wrapper = std::make_unique<SlangcSession>();
+namespace
+{
+    const char kDependencyGraphMagic[4] = {'S', 'L', 'C', 'D'};
 
-    SessionDesc sessionDesc = {};
-    std::vector<TargetDesc> targets;
+    // Canonical form used to match recorded paths against changed paths
+    std::string normalizeDependencyPath(const std::string &path)
+    {
+        std::error_code ec;
+        std::filesystem::path normalized = std::filesystem::weakly_canonical(path, ec);
+        if (ec)
+            normalized = std::filesystem::absolute(path, ec).lexically_normal();
+        return normalized.generic_string();
+    }
 
-    // Set matrix layout mode
-    sessionDesc.defaultMatrixLayoutMode = desc ? convertMatrixLayoutMode(desc->matrixLayoutMode) : SLANG_MATRIX_LAYOUT_ROW_MAJOR;
+    struct DependencyRecord
+    {
+        std::vector<std::string> modules;
+        std::vector<std::string> entryPoints;
+        std::vector<std::string> files; // Normalized paths
+    };
 
-    if (desc && desc->targetCount > 0)
+    // Copies names into an array the caller releases with slangc_releaseInvalidation
+    const char **copyNameArray(const std::vector<std::string> &names)
     {
-        targets.resize(desc->targetCount);
-        for (int32_t i = 0; i < desc->targetCount; i++)
+        auto array = new const char *[names.size()];
+        for (size_t i = 0; i < names.size(); i++)
         {
-            targets[i].format = convertCompileTarget(desc->targets[i]);
-            targets[i].profile = (SlangProfileID)profile; // Set the profile for each target
+            auto copy = new char[names[i].size() + 1];
+            std::memcpy(copy, names[i].c_str(), names[i].size() + 1);
+            array[i] = copy;
         }
-        sessionDesc.targets = targets.data();
-        sessionDesc.targetCount = desc->targetCount;
+        return array;
     }
-    else
+
+    void releaseNameArray(const char **names, int32_t count)
     {
-        // Default to SPIRV target if none specified
-        targets.resize(1);
-        targets[0].format = SLANG_SPIRV;
-        targets[0].profile = (SlangProfileID)profile; // Set the profile
-        sessionDesc.targets = targets.data();
-        sessionDesc.targetCount = 1;
+        for (int32_t i = 0; names && i < count; i++)
+            delete[] names[i];
+        delete[] names;
     }
+}
 
-    SlangResult result = globalSession->session->createSession(sessionDesc, wrapper->session.writeRef());
-    if (SLANG_FAILED(result))
+struct SlangcDependencyGraph
+{
+    std::string path;
+    std::mutex mutex;
+    std::unordered_map<std::string, DependencyRecord> outputs;                    // Keyed by output name
+    std::unordered_map<std::string, std::unordered_set<std::string>> fileOutputs; // Normalized path to output names
+
+    void setRecord(const std::string &outputName, DependencyRecord &&record)
     {
-        setError("Failed to create session with profile");
+        auto existing = outputs.find(outputName);
+        if (existing != outputs.end())
+        {
+            for (const std::string &file : existing->second.files)
+            {
+                auto found = fileOutputs.find(file);
+                if (found != fileOutputs.end() && found->second.erase(outputName) && found->second.empty())
+                    fileOutputs.erase(found);
+            }
+        }
+
+        for (const std::string &file : record.files)
+            fileOutputs[file].insert(outputName);
+        outputs[outputName] = std::move(record);
+    }
+};
+
+int32_t slangc_getModuleDependencyFileCount(SlangcModule *module)
+{
+    clearError();
+    if (!module || !module->module)
+    {
+        setError("Invalid module");
+        return -1;
+    }
+    return module->module->getDependencyFileCount();
+}
+
+const char *slangc_getModuleDependencyFilePath(SlangcModule *module, int32_t index)
+{
+    clearError();
+    if (!module || !module->module || index < 0 || index >= module->module->getDependencyFileCount())
+    {
+        setError("Invalid module or dependency index");
         return nullptr;
     }
+    return module->module->getDependencyFilePath(index);
+}
 
-    return wrapper.release();
+SlangcResult slangc_writeDepfile(SlangcComponentType *componentType, const char *targetPath, const char *depfilePath)
+{
+    clearError();
+    if (!getComponentType(componentType) || !targetPath || !depfilePath)
+    {
+        setError("Invalid parameters for depfile writing");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    if (!writeDepfile(componentType, targetPath, depfilePath))
+    {
+        setError("Failed to write depfile");
+        return SLANGC_FAIL;
+    }
+    return SLANGC_OK;
 }
 
-void slangc_releaseSession(SlangcSession *session)
+SlangcDependencyGraph *slangc_createDependencyGraph(const char *path)
 {
-    delete session;
+    clearError();
+    auto graph = std::make_unique<SlangcDependencyGraph>();
+    if (!path)
+        return graph.release();
+
+    graph->path = path;
+    std::vector<uint8_t> data;
+    if (!readTaggedFile(graph->path, kDependencyGraphMagic, std::string(), data))
+        return graph.release();
+
+    // A graph that fails to parse is discarded; the next build records it again
+    const uint8_t *cursor = data.data();
+    const uint8_t *end = cursor + data.size();
+    uint32_t outputCount = 0;
+    bool valid = readCacheU32(cursor, end, outputCount);
+    for (uint32_t i = 0; valid && i < outputCount; i++)
+    {
+        std::string outputName;
+        DependencyRecord record;
+        valid = readCacheString(cursor, end, outputName) &&
+                readCacheStrings(cursor, end, record.modules) &&
+                readCacheStrings(cursor, end, record.entryPoints) &&
+                readCacheStrings(cursor, end, record.files);
+        if (valid)
+            graph->setRecord(outputName, std::move(record));
+    }
+
+    if (!valid)
+    {
+        graph->outputs.clear();
+        graph->fileOutputs.clear();
+    }
+    return graph.release();
+}
+
+void slangc_releaseDependencyGraph(SlangcDependencyGraph *graph)
+{
+    delete graph;
+}
+
+SlangcResult slangc_saveDependencyGraph(SlangcDependencyGraph *graph)
+{
+    clearError();
+    if (!graph || graph->path.empty())
+    {
+        setError("Dependency graph has no file to save to");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    std::vector<uint8_t> data;
+    {
+        std::lock_guard<std::mutex> lock(graph->mutex);
+        appendCacheU32(data, static_cast<uint32_t>(graph->outputs.size()));
+        for (const auto &output : graph->outputs)
+        {
+            appendCacheString(data, output.first);
+            appendCacheStrings(data, output.second.modules);
+            appendCacheStrings(data, output.second.entryPoints);
+            appendCacheStrings(data, output.second.files);
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::path path(graph->path);
+    if (path.has_parent_path())
+        std::filesystem::create_directories(path.parent_path(), ec);
+    if (!writeTaggedFile(path, kDependencyGraphMagic, std::string(), data.data(), data.size()))
+    {
+        setError("Failed to write dependency graph: " + graph->path);
+        return SLANGC_FAIL;
+    }
+    return SLANGC_OK;
+}
+
+SlangcResult slangc_recordDependencies(
+    SlangcDependencyGraph *graph,
+    const char *outputName,
+    SlangcComponentType *componentType)
+{
+    clearError();
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!graph || !outputName || !slangComponentType)
+    {
+        setError("Invalid parameters for dependency recording");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    std::vector<Slang::ComPtr<IModule>> modules;
+    collectComponentModules(componentType, 1, modules);
+
+    DependencyRecord record;
+    std::unordered_set<std::string> files;
+    for (const auto &module : modules)
+    {
+        const char *name = module->getName();
+        record.modules.push_back(name ? name : "");
+        for (int32_t i = 0; i < module->getDependencyFileCount(); i++)
+        {
+            const char *path = module->getDependencyFilePath(i);
+            if (!path)
+                continue;
+            std::string normalized = normalizeDependencyPath(path);
+            if (files.insert(normalized).second)
+                record.files.push_back(std::move(normalized));
+        }
+    }
+
+    if (ProgramLayout *layout = slangComponentType->getLayout())
+    {
+        for (SlangUInt i = 0; i < layout->getEntryPointCount(); i++)
+        {
+            const char *name = layout->getEntryPointByIndex(i)->getName();
+            record.entryPoints.push_back(name ? name : "");
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(graph->mutex);
+    graph->setRecord(outputName, std::move(record));
+    return SLANGC_OK;
+}
+
+SlangcResult slangc_invalidate(
+    SlangcDependencyGraph *graph,
+    const char **paths,
+    int32_t pathCount,
+    SlangcInvalidation *outInvalidation)
+{
+    clearError();
+    if (outInvalidation)
+        *outInvalidation = {};
+
+    if (!graph || !outInvalidation || pathCount < 0 || (pathCount > 0 && !paths))
+    {
+        setError("Invalid parameters for invalidation");
+        return SLANGC_E_INVALID_ARG;
+    }
+
+    std::vector<std::string> outputNames;
+    std::vector<std::string> moduleNames;
+    std::vector<std::string> entryPointNames;
+    std::vector<int32_t> entryPointOutputs;
+    {
+        std::lock_guard<std::mutex> lock(graph->mutex);
+        std::unordered_set<std::string> seenOutputs;
+        for (int32_t i = 0; i < pathCount; i++)
+        {
+            if (!paths[i])
+                continue;
+
+            auto found = graph->fileOutputs.find(normalizeDependencyPath(paths[i]));
+            if (found == graph->fileOutputs.end())
+                continue;
+            for (const std::string &outputName : found->second)
+            {
+                if (seenOutputs.insert(outputName).second)
+                    outputNames.push_back(outputName);
+            }
+        }
+
+        // Report outputs in a stable order with each module once. Entry points are listed
+        // per output, since outputs built from different modules may share entry point names
+        std::sort(outputNames.begin(), outputNames.end());
+        std::unordered_set<std::string> seenModules;
+        for (size_t i = 0; i < outputNames.size(); i++)
+        {
+            const DependencyRecord &record = graph->outputs[outputNames[i]];
+            for (const std::string &module : record.modules)
+            {
+                if (seenModules.insert(module).second)
+                    moduleNames.push_back(module);
+            }
+            for (const std::string &entryPoint : record.entryPoints)
+            {
+                entryPointNames.push_back(entryPoint);
+                entryPointOutputs.push_back(static_cast<int32_t>(i));
+            }
+        }
+    }
+
+    outInvalidation->outputCount = static_cast<int32_t>(outputNames.size());
+    outInvalidation->outputNames = copyNameArray(outputNames);
+    outInvalidation->moduleCount = static_cast<int32_t>(moduleNames.size());
+    outInvalidation->moduleNames = copyNameArray(moduleNames);
+    outInvalidation->entryPointCount = static_cast<int32_t>(entryPointNames.size());
+    outInvalidation->entryPointNames = copyNameArray(entryPointNames);
+    auto outputIndices = new int32_t[entryPointOutputs.size()];
+    std::copy(entryPointOutputs.begin(), entryPointOutputs.end(), outputIndices);
+    outInvalidation->entryPointOutputs = outputIndices;
+    return SLANGC_OK;
+}
+
+void slangc_releaseInvalidation(SlangcInvalidation *invalidation)
+{
+    if (!invalidation)
+        return;
+
+    releaseNameArray(invalidation->outputNames, invalidation->outputCount);
+    releaseNameArray(invalidation->moduleNames, invalidation->moduleCount);
+    releaseNameArray(invalidation->entryPointNames, invalidation->entryPointCount);
+    delete[] invalidation->entryPointOutputs;
+    *invalidation = {};
 }
 
 //
-// Module Loading
+// Hot Reload
 //
 
-SlangcModule *slangc_loadModule(
-    SlangcSession *session,
-    const char *moduleName,
-    SlangcBlob **outDiagnostics)
+#ifdef __linux__
+
+namespace
 {
-    clearError();
-    if (!isSlangAvailable())
+    const uint32_t kDefaultDebounceMilliseconds = 20;
+
+    struct HotReloadJob
     {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
+        int32_t watchId = -1;
+        std::string moduleName;
+        std::string entryPointName;
+        SlangcStage stage = SLANGC_STAGE_NONE;
+        SlangcCompileTarget target = SLANGC_TARGET_UNKNOWN;
+        std::vector<std::string> macros;
+        std::vector<const char *> macroPointers;
+        std::string macroKey;
+        std::string depfilePath;
+        std::string outputPath;
+        std::unordered_set<std::string> files;       // Normalized paths the last compile read
+        std::unordered_set<std::string> directories; // Where the module may appear while it has never loaded
+
+        SlangcCompileJob getJob() const
+        {
+            SlangcCompileJob job = {};
+            job.moduleName = moduleName.c_str();
+            job.entryPointName = entryPointName.c_str();
+            job.stage = stage;
+            job.target = target;
+            job.preprocessorMacros = macroPointers.empty() ? nullptr : const_cast<const char **>(macroPointers.data());
+            job.preprocessorMacroCount = static_cast<int32_t>(macroPointers.size());
+            job.depfilePath = depfilePath.empty() ? nullptr : depfilePath.c_str();
+            job.outputPath = outputPath.empty() ? nullptr : outputPath.c_str();
+            return job;
+        }
+    };
+
+    // A checked module kept between rebuilds so it is not parsed again
+    struct HotReloadModule
+    {
+        std::string name;
+        std::string path;
+        std::vector<std::string> files; // Normalized
+        Slang::ComPtr<ISlangBlob> ir;
+    };
+}
+
+struct SlangcHotReload
+{
+    CompileSettings settings;
+    std::vector<std::string> searchPaths;
+    std::vector<const char *> searchPathPointers;
+    SlangcSessionPool *pool = nullptr;
+    bool ownsPool = false;
+    uint32_t debounceMilliseconds = kDefaultDebounceMilliseconds;
+    SlangcHotReloadCallback callback = nullptr;
+    void *userData = nullptr;
+
+    // Jobs added by slangc_watchEntryPoint and not yet compiled, and watches removed by
+    // slangc_unwatchEntryPoint and not yet dropped
+    std::mutex mutex;
+    std::vector<std::unique_ptr<HotReloadJob>> newJobs;
+    std::vector<int32_t> removedWatchIds;
+    int32_t nextWatchId = 0;
+
+    // Only touched by the service thread
+    std::vector<std::unique_ptr<HotReloadJob>> jobs;
+    std::unordered_map<std::string, HotReloadModule> modules; // Keyed by macro key and module name
+    std::unordered_map<int, std::string> watchDirectories;    // inotify watch to directory
+    std::unordered_set<std::string> watchedDirectories;
+    std::unordered_set<std::string> watchedFiles;
+    std::unordered_set<std::string> retryDirectories; // Any change here retries jobs that never loaded
+    bool rebuildAll = false;                          // Set when inotify dropped events
+
+    int inotifyFd = -1;
+    int wakeFd = -1;
+    std::atomic<bool> stop{false};
+    std::thread thread;
+};
+
+namespace
+{
+    void wakeHotReload(SlangcHotReload *hotReload)
+    {
+        uint64_t value = 1;
+        ssize_t written = write(hotReload->wakeFd, &value, sizeof(value));
+        (void)written;
     }
 
-    if (!session || !moduleName)
+    void watchHotReloadDirectory(SlangcHotReload *hotReload, const std::string &directory)
     {
-        setError("Invalid session or module name");
-        return nullptr;
+        if (!hotReload->watchedDirectories.insert(directory).second)
+            return;
+
+        int watch = inotify_add_watch(hotReload->inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+        if (watch >= 0)
+            hotReload->watchDirectories[watch] = directory;
+        else
+            hotReload->watchedDirectories.erase(directory); // Try again once it exists
     }
 
-    auto wrapper = std::make_unique<SlangcModule>();
-    Slang::ComPtr<ISlangBlob> diagnostics;
+    // Adds the files of every watched job to the watch set, watching their directories
+    // so that editors which save by renaming a new file into place are seen too, and
+    // stops watching directories no job needs any more
+    void updateHotReloadWatches(SlangcHotReload *hotReload)
+    {
+        hotReload->watchedFiles.clear();
+        hotReload->retryDirectories.clear();
+        std::unordered_set<std::string> directories;
+        for (const auto &job : hotReload->jobs)
+        {
+            for (const std::string &file : job->files)
+            {
+                hotReload->watchedFiles.insert(file);
+                directories.insert(std::filesystem::path(file).parent_path().generic_string());
+            }
+            for (const std::string &directory : job->directories)
+            {
+                hotReload->retryDirectories.insert(directory);
+                directories.insert(directory);
+            }
+        }
 
-    wrapper->module = session->session->loadModule(moduleName, diagnostics.writeRef());
-    if (!wrapper->module)
+        for (auto it = hotReload->watchDirectories.begin(); it != hotReload->watchDirectories.end();)
+        {
+            if (directories.count(it->second))
+            {
+                ++it;
+                continue;
+            }
+            inotify_rm_watch(hotReload->inotifyFd, it->first);
+            hotReload->watchedDirectories.erase(it->second);
+            it = hotReload->watchDirectories.erase(it);
+        }
+        for (const std::string &directory : directories)
+            watchHotReloadDirectory(hotReload, directory);
+    }
+
+    // Drops unwatched jobs, the checked modules only they used and the directory watches
+    // only they needed
+    void removeHotReloadJobs(
+        SlangcHotReload *hotReload,
+        std::vector<std::unique_ptr<HotReloadJob>> &newJobs,
+        const std::vector<int32_t> &removedWatchIds)
     {
-        setDiagnosticsOutput(outDiagnostics, diagnostics);
-        setError("Failed to load module");
-        return nullptr;
+        auto isRemoved = [&removedWatchIds](const std::unique_ptr<HotReloadJob> &job)
+        {
+            return std::find(removedWatchIds.begin(), removedWatchIds.end(), job->watchId) != removedWatchIds.end();
+        };
+        newJobs.erase(std::remove_if(newJobs.begin(), newJobs.end(), isRemoved), newJobs.end());
+        hotReload->jobs.erase(std::remove_if(hotReload->jobs.begin(), hotReload->jobs.end(), isRemoved), hotReload->jobs.end());
+
+        std::unordered_set<std::string> macroKeys;
+        for (const auto &job : hotReload->jobs)
+            macroKeys.insert(job->macroKey);
+        for (const auto &job : newJobs)
+            macroKeys.insert(job->macroKey);
+        for (auto it = hotReload->modules.begin(); it != hotReload->modules.end();)
+        {
+            std::string macroKey = it->first.substr(0, it->first.find('\0'));
+            it = macroKeys.count(macroKey) ? std::next(it) : hotReload->modules.erase(it);
+        }
+
+        updateHotReloadWatches(hotReload);
     }
 
-    setDiagnosticsOutput(outDiagnostics, diagnostics);
-    return wrapper.release();
+    // Directories a module that has never loaded could be created in: the search paths,
+    // the working directory and, for a path-like name, the directory it names
+    std::unordered_set<std::string> getHotReloadModuleDirectories(SlangcHotReload *hotReload, const std::string &moduleName)
+    {
+        std::unordered_set<std::string> directories;
+        directories.insert(normalizeDependencyPath("."));
+        for (const std::string &searchPath : hotReload->searchPaths)
+        {
+            if (!searchPath.empty())
+                directories.insert(normalizeDependencyPath(searchPath));
+        }
+        std::filesystem::path parent = std::filesystem::path(moduleName).parent_path();
+        if (!parent.empty())
+        {
+            directories.insert(normalizeDependencyPath(parent.string()));
+            for (const std::string &searchPath : hotReload->searchPaths)
+            {
+                if (!searchPath.empty() && parent.is_relative())
+                    directories.insert(normalizeDependencyPath((std::filesystem::path(searchPath) / parent).string()));
+            }
+        }
+        return directories;
+    }
+
+    void readHotReloadEvents(SlangcHotReload *hotReload, std::unordered_set<std::string> &changedFiles)
+    {
+        alignas(inotify_event) char buffer[4096];
+        for (;;)
+        {
+            ssize_t size = read(hotReload->inotifyFd, buffer, sizeof(buffer));
+            if (size <= 0)
+                return;
+
+            for (char *cursor = buffer; cursor < buffer + size;)
+            {
+                auto event = reinterpret_cast<inotify_event *>(cursor);
+                cursor += sizeof(inotify_event) + event->len;
+
+                // Events were dropped, so any file may have changed unseen
+                if (event->mask & IN_Q_OVERFLOW)
+                {
+                    hotReload->rebuildAll = true;
+                    continue;
+                }
+
+                auto directory = hotReload->watchDirectories.find(event->wd);
+                if (directory == hotReload->watchDirectories.end() || event->len == 0)
+                    continue;
+
+                std::string path = directory->second + "/" + event->name;
+                if (hotReload->watchedFiles.count(path) || hotReload->retryDirectories.count(directory->second))
+                    changedFiles.insert(std::move(path));
+            }
+        }
+    }
+
+    // Loads the checked modules kept for a macro set into a new session, smallest
+    // dependency list first so every module's imports are already loaded
+    void loadHotReloadModules(SlangcHotReload *hotReload, SlangcSession *session, const std::string &macroKey)
+    {
+        std::vector<const HotReloadModule *> modules;
+        std::string prefix = macroKey + '\0';
+        for (const auto &module : hotReload->modules)
+        {
+            if (module.first.compare(0, prefix.size(), prefix) == 0)
+                modules.push_back(&module.second);
+        }
+        std::sort(modules.begin(), modules.end(), [](const HotReloadModule *a, const HotReloadModule *b)
+                  { return a->files.size() < b->files.size(); });
+
+        for (const HotReloadModule *module : modules)
+        {
+            if (isModuleLoaded(session->session, module->name))
+                continue;
+
+            Slang::ComPtr<ISlangBlob> diagnostics;
+            session->session->loadModuleFromIRBlob(
+                module->name.c_str(), module->path.c_str(), module->ir, diagnostics.writeRef());
+        }
+    }
+
+    // Keeps the checked form of every module a session loaded from source
+    void storeHotReloadModules(SlangcHotReload *hotReload, SlangcSession *session, const std::string &macroKey)
+    {
+        ISession *slangSession = session->session;
+        for (SlangInt i = 0; i < slangSession->getLoadedModuleCount(); i++)
+        {
+            IModule *loaded = slangSession->getLoadedModule(i);
+            const char *name = loaded->getName();
+            const char *path = loaded->getFilePath();
+            if (!name || !path || !path[0])
+                continue;
+
+            std::string key = macroKey + '\0' + name;
+            if (hotReload->modules.count(key))
+                continue;
+
+            HotReloadModule module;
+            if (SLANG_FAILED(loaded->serialize(module.ir.writeRef())) || !module.ir)
+                continue;
+            module.name = name;
+            module.path = path;
+            for (int32_t f = 0; f < loaded->getDependencyFileCount(); f++)
+                module.files.push_back(normalizeDependencyPath(loaded->getDependencyFilePath(f)));
+            hotReload->modules.emplace(std::move(key), std::move(module));
+        }
+    }
+
+    // Recompiles the new jobs and every job that read a changed file, then reports
+    // each result through the callback
+    void rebuildHotReload(
+        SlangcHotReload *hotReload,
+        std::vector<std::unique_ptr<HotReloadJob>> &newJobs,
+        const std::unordered_set<std::string> &changedFiles)
+    {
+        bool rebuildAll = hotReload->rebuildAll;
+        hotReload->rebuildAll = false;
+        auto readsChangedFile = [&changedFiles, rebuildAll](const auto &files)
+        {
+            if (rebuildAll)
+                return true;
+            for (const std::string &file : files)
+            {
+                if (changedFiles.count(file))
+                    return true;
+            }
+            return false;
+        };
+        auto changedInDirectory = [&changedFiles, rebuildAll](const std::unordered_set<std::string> &directories)
+        {
+            if (rebuildAll)
+                return true;
+            for (const std::string &file : changedFiles)
+            {
+                if (directories.count(std::filesystem::path(file).parent_path().generic_string()))
+                    return true;
+            }
+            return false;
+        };
+
+        for (auto it = hotReload->modules.begin(); it != hotReload->modules.end();)
+            it = readsChangedFile(it->second.files) ? hotReload->modules.erase(it) : std::next(it);
+
+        std::map<std::string, std::vector<HotReloadJob *>> groups; // Keyed by macro key
+        for (const auto &job : hotReload->jobs)
+        {
+            if (readsChangedFile(job->files) || changedInDirectory(job->directories))
+                groups[job->macroKey].push_back(job.get());
+        }
+        for (auto &job : newJobs)
+        {
+            groups[job->macroKey].push_back(job.get());
+            hotReload->jobs.push_back(std::move(job));
+        }
+        newJobs.clear();
+        if (groups.empty())
+            return;
+
+        if (hotReload->settings.fileSystem)
+            slangc_clearFileSystemCache(hotReload->settings.fileSystem);
+
+        std::vector<std::pair<int32_t, SlangcCompileJobResult>> results;
+        SlangcGlobalSession *globalSession = slangc_acquireGlobalSession(hotReload->pool);
+        for (auto &group : groups)
+        {
+            std::vector<SlangcCompileTarget> targets;
+            for (HotReloadJob *job : group.second)
+            {
+                if (std::find(targets.begin(), targets.end(), job->target) == targets.end())
+                    targets.push_back(job->target);
+            }
+
+            SlangcSession *session = nullptr;
+            if (globalSession)
+            {
+                SlangcCompileJob first = group.second[0]->getJob();
+                SlangcSessionDesc sessionDesc = {};
+                sessionDesc.targets = targets.data();
+                sessionDesc.targetCount = static_cast<int32_t>(targets.size());
+                sessionDesc.searchPaths = hotReload->settings.searchPaths;
+                sessionDesc.searchPathCount = hotReload->settings.searchPathCount;
+                sessionDesc.preprocessorMacros = first.preprocessorMacros;
+                sessionDesc.preprocessorMacroCount = first.preprocessorMacroCount;
+                sessionDesc.matrixLayoutMode = hotReload->settings.matrixLayoutMode;
+                sessionDesc.fileSystem = hotReload->settings.fileSystem;
+                sessionDesc.timingProfile = hotReload->settings.timingProfile;
+                session = createSessionFromDesc(globalSession, &sessionDesc, SLANG_PROFILE_UNKNOWN);
+            }
+            if (session)
+                loadHotReloadModules(hotReload, session, group.first);
+
+            std::unordered_map<std::string, SlangcModule *> modules;
+            std::unordered_map<std::string, std::string> moduleDiagnostics;
+            for (HotReloadJob *job : group.second)
+            {
+                SlangcCompileJobResult result = {};
+                if (!session)
+                {
+                    failCompileJob(result, SLANGC_FAIL, "");
+                    results.emplace_back(job->watchId, result);
+                    continue;
+                }
+
+                auto inserted = modules.emplace(job->moduleName, nullptr);
+                if (inserted.second)
+                {
+                    SlangcBlob *loadDiagnostics = nullptr;
+                    inserted.first->second = slangc_loadModule(session, job->moduleName.c_str(), &loadDiagnostics);
+                    appendDiagnostics(moduleDiagnostics[job->moduleName], loadDiagnostics);
+                }
+
+                // A module that fails to load keeps its old files so the fix is seen; one
+                // that has never loaded watches where its file could appear instead
+                SlangcModule *module = inserted.first->second;
+                const std::string &diagnostics = moduleDiagnostics[job->moduleName];
+                if (!module)
+                {
+                    if (job->files.empty())
+                        job->directories = getHotReloadModuleDirectories(hotReload, job->moduleName);
+                    failCompileJob(result, SLANGC_FAIL, diagnostics);
+                    results.emplace_back(job->watchId, result);
+                    continue;
+                }
+
+                job->directories.clear();
+                job->files.clear();
+                for (int32_t f = 0; f < module->module->getDependencyFileCount(); f++)
+                    job->files.insert(normalizeDependencyPath(module->module->getDependencyFilePath(f)));
+
+                int32_t targetIndex = static_cast<int32_t>(
+                    std::find(targets.begin(), targets.end(), job->target) - targets.begin());
+                compileJob(session, module, job->getJob(), targetIndex, diagnostics, result);
+                results.emplace_back(job->watchId, result);
+            }
+
+            if (session)
+                storeHotReloadModules(hotReload, session, group.first);
+            for (auto &module : modules)
+                slangc_releaseModule(module.second);
+            slangc_releaseSession(session);
+        }
+        if (globalSession)
+            slangc_returnGlobalSession(hotReload->pool, globalSession);
+
+        updateHotReloadWatches(hotReload);
+        for (auto &result : results)
+            hotReload->callback(result.first, &result.second, hotReload->userData);
+    }
+
+    void runHotReload(SlangcHotReload *hotReload)
+    {
+        std::unordered_set<std::string> changedFiles;
+        std::vector<std::unique_ptr<HotReloadJob>> newJobs;
+        std::vector<int32_t> removedWatchIds;
+        while (!hotReload->stop)
+        {
+            // Wait indefinitely while idle; once a change is seen, wait for writes to go quiet
+            pollfd fds[2] = {{hotReload->inotifyFd, POLLIN, 0}, {hotReload->wakeFd, POLLIN, 0}};
+            bool pending = !changedFiles.empty() || hotReload->rebuildAll;
+            int timeout = pending ? static_cast<int>(hotReload->debounceMilliseconds) : -1;
+            int ready = poll(fds, 2, timeout);
+            if (ready < 0 && errno != EINTR)
+                break;
+
+            if (ready > 0 && (fds[1].revents & POLLIN))
+            {
+                uint64_t value = 0;
+                ssize_t bytesRead = read(hotReload->wakeFd, &value, sizeof(value));
+                (void)bytesRead;
+            }
+            if (hotReload->stop)
+                break;
+
+            if (ready > 0 && (fds[0].revents & POLLIN))
+            {
+                readHotReloadEvents(hotReload, changedFiles);
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(hotReload->mutex);
+                newJobs.swap(hotReload->newJobs);
+                removedWatchIds.swap(hotReload->removedWatchIds);
+            }
+            if (!removedWatchIds.empty())
+            {
+                removeHotReloadJobs(hotReload, newJobs, removedWatchIds);
+                removedWatchIds.clear();
+            }
+
+            // Changes are only applied once quiet; new jobs are compiled right away
+            if (ready == 0)
+            {
+                rebuildHotReload(hotReload, newJobs, changedFiles);
+                changedFiles.clear();
+            }
+            else if (!newJobs.empty())
+            {
+                rebuildHotReload(hotReload, newJobs, {});
+            }
+        }
+    }
 }
 
-SlangcModule *slangc_loadModuleFromSource(
-    SlangcSession *session,
-    const char *moduleName,
-    const char *path,
-    const char *sourceText,
-    size_t sourceSize,
-    SlangcBlob **outDiagnostics)
+SlangcHotReload *slangc_createHotReload(const SlangcHotReloadDesc *desc)
 {
-
+    clearError();
     if (!isSlangAvailable())
     {
         setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
         return nullptr;
     }
 
-    clearError();
-    if (!session || !moduleName || !sourceText)
+    if (!desc || !desc->callback || desc->searchPathCount < 0)
     {
-        setError("Invalid session, module name, or source text");
+        setError("Invalid parameters for hot reload");
         return nullptr;
     }
 
-    auto wrapper = std::make_unique<SlangcModule>();
-    Slang::ComPtr<ISlangBlob> diagnostics;
-
-    // Create a blob from the source text
-    std::string source(sourceText, sourceSize == 0 ? strlen(sourceText) : sourceSize);
-    Slang::ComPtr<ISlangBlob> sourceBlob;
-    // Note: We would need to create a blob implementation here
-    // For now, we'll use the string directly
-
-    wrapper->module = session->session->loadModuleFromSource(
-        moduleName, path, nullptr, diagnostics.writeRef());
+    auto hotReload = std::make_unique<SlangcHotReload>();
+    for (int32_t i = 0; i < desc->searchPathCount; i++)
+        hotReload->searchPaths.push_back(desc->searchPaths && desc->searchPaths[i] ? desc->searchPaths[i] : "");
+    for (const auto &path : hotReload->searchPaths)
+        hotReload->searchPathPointers.push_back(path.c_str());
+    hotReload->settings.searchPaths = hotReload->searchPathPointers.data();
+    hotReload->settings.searchPathCount = static_cast<int32_t>(hotReload->searchPathPointers.size());
+    hotReload->settings.matrixLayoutMode = desc->matrixLayoutMode;
+    hotReload->settings.fileSystem = desc->fileSystem;
+    hotReload->settings.timingProfile = desc->timingProfile;
+    if (desc->debounceMilliseconds > 0)
+        hotReload->debounceMilliseconds = desc->debounceMilliseconds;
+    hotReload->callback = desc->callback;
+    hotReload->userData = desc->userData;
 
-    if (!wrapper->module)
+    hotReload->inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    hotReload->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (hotReload->inotifyFd < 0 || hotReload->wakeFd < 0)
     {
-        setDiagnosticsOutput(outDiagnostics, diagnostics);
-        setError("Failed to load module from source");
+        if (hotReload->inotifyFd >= 0)
+            close(hotReload->inotifyFd);
+        if (hotReload->wakeFd >= 0)
+            close(hotReload->wakeFd);
+        setError("Failed to create file watch for hot reload");
         return nullptr;
     }
 
-    setDiagnosticsOutput(outDiagnostics, diagnostics);
-    return wrapper.release();
+    hotReload->pool = desc->pool;
+    if (!hotReload->pool)
+    {
+        SlangcSessionPoolDesc poolDesc = {};
+        poolDesc.maxGlobalSessions = 1;
+        hotReload->pool = slangc_createSessionPool(&poolDesc);
+        if (!hotReload->pool)
+        {
+            close(hotReload->inotifyFd);
+            close(hotReload->wakeFd);
+            return nullptr;
+        }
+        hotReload->ownsPool = true;
+    }
+
+    SlangcHotReload *self = hotReload.get();
+    hotReload->thread = std::thread([self]
+                                    { runHotReload(self); });
+    return hotReload.release();
 }
 
-void slangc_releaseModule(SlangcModule *module)
+void slangc_releaseHotReload(SlangcHotReload *hotReload)
 {
-    delete module;
-}
+    if (!hotReload)
+        return;
 
-//
-// Component Type Management
-//
+    hotReload->stop = true;
+    wakeHotReload(hotReload);
+    hotReload->thread.join();
 
-SlangcComponentTypeKind slangc_getComponentTypeKind(SlangcComponentType *componentType)
+    close(hotReload->inotifyFd);
+    close(hotReload->wakeFd);
+    if (hotReload->ownsPool)
+        slangc_releaseSessionPool(hotReload->pool);
+    delete hotReload;
+}
+
+int32_t slangc_watchEntryPoint(SlangcHotReload *hotReload, const SlangcCompileJob *job)
 {
-    if (!componentType)
+    clearError();
+    if (!hotReload || !job || !job->moduleName || !job->entryPointName || job->preprocessorMacroCount < 0)
     {
-        return SLANGC_COMPONENT_TYPE_MODULE; // Default fallback
+        setError("Invalid parameters for watching an entry point");
+        return -1;
     }
-    return componentType->kind;
-}
 
-SlangcModule *slangc_getComponentTypeModule(SlangcComponentType *componentType)
-{
-    if (!componentType || componentType->kind != SLANGC_COMPONENT_TYPE_MODULE)
+    auto watched = std::make_unique<HotReloadJob>();
+    watched->moduleName = job->moduleName;
+    watched->entryPointName = job->entryPointName;
+    watched->stage = job->stage;
+    watched->target = job->target;
+    for (int32_t i = 0; i < job->preprocessorMacroCount; i++)
     {
-        return nullptr;
+        if (job->preprocessorMacros && job->preprocessorMacros[i])
+            watched->macros.push_back(job->preprocessorMacros[i]);
     }
-    return componentType->module;
-}
+    for (const std::string &macro : watched->macros)
+        watched->macroPointers.push_back(macro.c_str());
+    watched->macroKey = makeMacroKey(watched->macroPointers.data(), static_cast<int32_t>(watched->macroPointers.size()));
+    watched->depfilePath = job->depfilePath ? job->depfilePath : "";
+    watched->outputPath = job->outputPath ? job->outputPath : "";
 
-SlangcEntryPoint *slangc_getComponentTypeEntryPoint(SlangcComponentType *componentType)
-{
-    if (!componentType || componentType->kind != SLANGC_COMPONENT_TYPE_ENTRY_POINT)
+    int32_t watchId;
     {
-        return nullptr;
+        std::lock_guard<std::mutex> lock(hotReload->mutex);
+        watchId = hotReload->nextWatchId++;
+        watched->watchId = watchId;
+        hotReload->newJobs.push_back(std::move(watched));
     }
-    return componentType->entryPoint;
+    wakeHotReload(hotReload);
+    return watchId;
 }
 
-SlangcEntryPoint *slangc_findEntryPoint(
-    SlangcModule *module,
-    const char *entryPointName,
-    SlangcStage stage,
-    SlangcBlob **outDiagnostics)
+SlangcResult slangc_unwatchEntryPoint(SlangcHotReload *hotReload, int32_t watchId)
 {
     clearError();
-    if (!isSlangAvailable())
-    {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
-    }
-
-    if (!module || !entryPointName)
+    if (!hotReload || watchId < 0)
     {
-        setError("Invalid module or entry point name");
-        return nullptr;
+        setError("Invalid parameters for unwatching an entry point");
+        return SLANGC_E_INVALID_ARG;
     }
 
-    auto wrapper = std::make_unique<SlangcEntryPoint>();
-    Slang::ComPtr<ISlangBlob> diagnostics;
-
-    SlangResult result = module->module->findAndCheckEntryPoint(
-        entryPointName,
-        convertStage(stage),
-        wrapper->entryPoint.writeRef(),
-        diagnostics.writeRef());
-
-    if (SLANG_FAILED(result))
     {
-        setDiagnosticsOutput(outDiagnostics, diagnostics);
-        setError("Failed to find entry point");
-        return nullptr;
+        std::lock_guard<std::mutex> lock(hotReload->mutex);
+        if (watchId >= hotReload->nextWatchId)
+        {
+            setError("Unknown watch ID");
+            return SLANGC_E_INVALID_ARG;
+        }
+        hotReload->removedWatchIds.push_back(watchId);
     }
-
-    setDiagnosticsOutput(outDiagnostics, diagnostics);
-    return wrapper.release();
+    wakeHotReload(hotReload);
+    return SLANGC_OK;
 }
 
-void slangc_releaseEntryPoint(SlangcEntryPoint *entryPoint)
+#else
+
+struct SlangcHotReload
 {
-    delete entryPoint;
-}
+};
 
-SlangcComponentType *slangc_createModuleComponentType(SlangcModule *module)
+SlangcHotReload *slangc_createHotReload(const SlangcHotReloadDesc *)
 {
     clearError();
-    if (!module)
-    {
-        setError("Invalid module");
-        return nullptr;
-    }
+    setError("Hot reload needs inotify and is only available on Linux");
+    return nullptr;
+}
 
-    auto wrapper = new SlangcComponentType();
-    wrapper->kind = SLANGC_COMPONENT_TYPE_MODULE;
-    wrapper->module = module;
-    return wrapper;
+void slangc_releaseHotReload(SlangcHotReload *hotReload)
+{
+    delete hotReload;
 }
 
-SlangcComponentType *slangc_createEntryPointComponentType(SlangcEntryPoint *entryPoint)
+int32_t slangc_watchEntryPoint(SlangcHotReload *, const SlangcCompileJob *)
 {
     clearError();
-    if (!entryPoint)
-    {
-        setError("Invalid entry point");
-        return nullptr;
-    }
-
-    auto wrapper = new SlangcComponentType();
-    wrapper->kind = SLANGC_COMPONENT_TYPE_ENTRY_POINT;
-    wrapper->entryPoint = entryPoint;
-    return wrapper;
+    setError("Hot reload needs inotify and is only available on Linux");
+    return -1;
 }
 
-SlangcComponentType *slangc_createCompositeComponentType(
-    SlangcSession *session,
-    const SlangcComponentType *componentTypes,
-    int32_t componentTypeCount,
-    SlangcBlob **outDiagnostics)
+SlangcResult slangc_unwatchEntryPoint(SlangcHotReload *, int32_t)
 {
     clearError();
-    if (!isSlangAvailable())
-    {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
-        return nullptr;
-    }
-
-    if (!session || !componentTypes || componentTypeCount <= 0)
-    {
-        setError("Invalid parameters for composite component type");
-        return nullptr;
-    }
+    setError("Hot reload needs inotify and is only available on Linux");
+    return SLANGC_E_INVALID_ARG;
+}
 
-    auto compositeWrapper = new SlangcComposite();
-    Slang::ComPtr<ISlangBlob> diagnostics;
+#endif
 
-    std::vector<IComponentType *> slangComponents(componentTypeCount);
-    for (int32_t i = 0; i < componentTypeCount; i++)
-    {
-        slangComponents[i] = getComponentType(&componentTypes[i]);
-        if (!slangComponents[i])
-        {
-            delete compositeWrapper;
-            setError("Invalid component type in array");
-            return nullptr;
-        }
-    }
+//
+// Host Execution
+//
 
-    SlangResult result = session->session->createCompositeComponentType(
-        slangComponents.data(),
-        componentTypeCount,
-        compositeWrapper->composite.writeRef(),
-        diagnostics.writeRef());
+struct SlangcHostCallable
+{
+    Slang::ComPtr<ISlangSharedLibrary> library;
+};
 
-    if (SLANG_FAILED(result))
+struct SlangcComputeDispatcher
+{
+    explicit SlangcComputeDispatcher(int32_t threadCount)
+        : workers(threadCount)
     {
-        delete compositeWrapper;
-        setDiagnosticsOutput(outDiagnostics, diagnostics);
-        setError("Failed to create composite component type");
-        return nullptr;
     }
 
-    auto wrapper = new SlangcComponentType();
-    wrapper->kind = SLANGC_COMPONENT_TYPE_COMPOSITE;
-    wrapper->composite = compositeWrapper;
-
-    setDiagnosticsOutput(outDiagnostics, diagnostics);
-    return wrapper;
-}
+    WorkStealingPool workers;
+    std::mutex dispatchMutex; // Dispatches run one at a time
+};
 
-SlangcComponentType *slangc_linkComponentType(
+SlangcHostCallable *slangc_getEntryPointHostCallable(
     SlangcComponentType *componentType,
+    int32_t entryPointIndex,
+    int32_t targetIndex,
     SlangcBlob **outDiagnostics)
 {
     clearError();
@@ -684,108 +7326,151 @@ SlangcComponentType *slangc_linkComponentType(
         return nullptr;
     }
 
-    if (!componentType)
+    IComponentType *slangComponentType = getComponentType(componentType);
+    if (!slangComponentType)
     {
         setError("Invalid component type");
         return nullptr;
     }
 
-    IComponentType *slangComponentType = getComponentType(componentType);
-    if (!slangComponentType)
+    SlangcSession *session = getOwningSession(componentType);
+    ProfileScope profileScope(session, SLANGC_PROFILE_PHASE_GET_HOST_CALLABLE);
+    TraceScope traceScope("codegen");
+    if (traceScope.isActive())
     {
-        setError("Invalid component type");
-        return nullptr;
+        std::string moduleNames;
+        std::vector<std::string> entryPointNames;
+        collectTraceNames(componentType, 1, moduleNames, entryPointNames);
+        traceScope.setModuleName(moduleNames.c_str());
+        if (entryPointIndex >= 0 && static_cast<size_t>(entryPointIndex) < entryPointNames.size())
+            traceScope.setEntryPointName(entryPointNames[entryPointIndex].c_str());
+        if (session && targetIndex >= 0 && static_cast<size_t>(targetIndex) < session->targets.size())
+            traceScope.setTarget(session->targets[targetIndex]);
     }
 
-    auto linkedCompositeWrapper = new SlangcComposite();
+    auto hostCallable = std::make_unique<SlangcHostCallable>();
     Slang::ComPtr<ISlangBlob> diagnostics;
-
-    SlangResult result = slangComponentType->link(
-        linkedCompositeWrapper->composite.writeRef(),
+    SlangResult result = slangComponentType->getEntryPointHostCallable(
+        entryPointIndex,
+        targetIndex,
+        hostCallable->library.writeRef(),
         diagnostics.writeRef());
+    profileScope.captureReports(diagnostics);
+    setDiagnosticsOutput(outDiagnostics, diagnostics);
 
-    if (SLANG_FAILED(result))
+    if (SLANG_FAILED(result) || !hostCallable->library)
     {
-        delete linkedCompositeWrapper;
-        setDiagnosticsOutput(outDiagnostics, diagnostics);
-        setError("Failed to link component type");
+        setError("Failed to get entry point host callable");
         return nullptr;
     }
 
-    auto wrapper = new SlangcComponentType();
-    wrapper->kind = SLANGC_COMPONENT_TYPE_COMPOSITE;
-    wrapper->composite = linkedCompositeWrapper;
-
-    setDiagnosticsOutput(outDiagnostics, diagnostics);
-    return wrapper;
+    return hostCallable.release();
 }
 
-void slangc_releaseComponentType(SlangcComponentType *componentType)
+void *slangc_findHostCallableFunction(SlangcHostCallable *hostCallable, const char *name)
 {
-    if (!componentType)
-        return;
-
-    // Clean up composite wrapper if it exists
-    if (componentType->kind == SLANGC_COMPONENT_TYPE_COMPOSITE && componentType->composite)
+    clearError();
+    if (!hostCallable || !name)
     {
-        delete static_cast<SlangcComposite *>(componentType->composite);
+        setError("Invalid parameters for host callable lookup");
+        return nullptr;
     }
 
-    delete componentType;
+    void *function = hostCallable->library->findSymbolAddressByName(name);
+    if (!function)
+        setError(std::string("Host callable symbol not found: ") + name);
+    return function;
 }
 
-SlangcBlob *slangc_getEntryPointCode(
-    SlangcComponentType *componentType,
-    int32_t entryPointIndex,
-    int32_t targetIndex,
-    SlangcBlob **outDiagnostics)
+void slangc_releaseHostCallable(SlangcHostCallable *hostCallable)
+{
+    delete hostCallable;
+}
+
+SlangcComputeDispatcher *slangc_createComputeDispatcher(int32_t threadCount)
 {
     clearError();
-    if (!isSlangAvailable())
+    if (threadCount < 0)
     {
-        setError("Slang has been shut down and cannot be used. Restart your application to use Slang again.");
+        setError("Invalid thread count for compute dispatcher");
         return nullptr;
     }
 
-    if (!componentType)
-    {
-        setError("Invalid component type");
-        return nullptr;
-    }
+    if (threadCount == 0)
+        threadCount = std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency()));
+    return new SlangcComputeDispatcher(threadCount);
+}
 
-    Slang::ComPtr<ISlangBlob> codeBlob;
-    Slang::ComPtr<ISlangBlob> diagnostics;
+void slangc_releaseComputeDispatcher(SlangcComputeDispatcher *dispatcher)
+{
+    delete dispatcher;
+}
 
-    IComponentType *slangComponentType = getComponentType(componentType);
-    if (!slangComponentType)
+SlangcResult slangc_dispatchCompute(SlangcComputeDispatcher *dispatcher, const SlangcDispatchDesc *desc)
+{
+    clearError();
+    if (!dispatcher || !desc || !desc->function)
     {
-        setError("Invalid component type");
-        return nullptr;
+        setError("Invalid parameters for compute dispatch");
+        return SLANGC_E_INVALID_ARG;
     }
 
-    SlangResult result = slangComponentType->getEntryPointCode(
-        entryPointIndex,
-        targetIndex,
-        codeBlob.writeRef(),
-        diagnostics.writeRef());
+    const uint32_t *groupCount = desc->groupCount;
+    if (groupCount[0] == 0 || groupCount[1] == 0 || groupCount[2] == 0)
+        return SLANGC_OK;
 
-    if (SLANG_FAILED(result))
+    // Aim for a few boxes per worker so stealing can even out uneven groups. Whole
+    // z-slices are split first, then rows, then runs of groups within a row.
+    const uint64_t targetBoxCount = uint64_t(dispatcher->workers.getThreadCount()) * 4;
+    auto divideRoundUp = [](uint64_t value, uint64_t divisor)
+    { return (value + divisor - 1) / divisor; };
+    uint32_t boxSize[3] = {groupCount[0], groupCount[1], 1};
+    if (groupCount[2] >= targetBoxCount)
     {
-        setDiagnosticsOutput(outDiagnostics, diagnostics);
-        setError("Failed to get entry point code");
-        return nullptr;
+        boxSize[2] = static_cast<uint32_t>(divideRoundUp(groupCount[2], targetBoxCount));
     }
-
-    setDiagnosticsOutput(outDiagnostics, diagnostics);
-
-    if (codeBlob)
+    else
     {
-        auto codeWrapper = std::make_unique<SlangcBlob>();
-        codeWrapper->blob = codeBlob;
-        return codeWrapper.release();
+        uint64_t boxesPerSlice = divideRoundUp(targetBoxCount, groupCount[2]);
+        if (groupCount[1] >= boxesPerSlice)
+        {
+            boxSize[1] = static_cast<uint32_t>(divideRoundUp(groupCount[1], boxesPerSlice));
+        }
+        else
+        {
+            boxSize[1] = 1;
+            boxSize[0] = static_cast<uint32_t>(divideRoundUp(groupCount[0], divideRoundUp(boxesPerSlice, groupCount[1])));
+        }
     }
 
-    return nullptr;
+    std::lock_guard<std::mutex> lock(dispatcher->dispatchMutex);
+    SlangcComputeFunc function = desc->function;
+    void *uniformEntryPointParams = desc->uniformEntryPointParams;
+    void *uniformState = desc->uniformState;
+    for (uint32_t z = 0; z < groupCount[2]; z += boxSize[2])
+    {
+        for (uint32_t y = 0; y < groupCount[1]; y += boxSize[1])
+        {
+            for (uint32_t x = 0; x < groupCount[0]; x += boxSize[0])
+            {
+                SlangcComputeVaryingInput box = {
+                    {x, y, z},
+                    {static_cast<uint32_t>(std::min<uint64_t>(uint64_t(x) + boxSize[0], groupCount[0])),
+                     static_cast<uint32_t>(std::min<uint64_t>(uint64_t(y) + boxSize[1], groupCount[1])),
+                     static_cast<uint32_t>(std::min<uint64_t>(uint64_t(z) + boxSize[2], groupCount[2]))}};
+                dispatcher->workers.submit([function, box, uniformEntryPointParams, uniformState](int32_t) mutable
+                                           { function(&box, uniformEntryPointParams, uniformState); });
+                if (uint64_t(x) + boxSize[0] >= groupCount[0])
+                    break;
+            }
+            if (uint64_t(y) + boxSize[1] >= groupCount[1])
+                break;
+        }
+        if (uint64_t(z) + boxSize[2] >= groupCount[2])
+            break;
+    }
+    dispatcher->workers.wait();
+    return SLANGC_OK;
 }
 
 //
@@ -10,12 +10,13 @@ extern "C"
 #include <stddef.h>
 #include <stdbool.h>
 
-    // Component type - can be either a module, entry point, or composite
+    // Component type - can be a module, entry point, composite, or type conformance
     typedef enum SlangcComponentTypeKind
     {
         SLANGC_COMPONENT_TYPE_MODULE,
         SLANGC_COMPONENT_TYPE_ENTRY_POINT,
-        SLANGC_COMPONENT_TYPE_COMPOSITE
+        SLANGC_COMPONENT_TYPE_COMPOSITE,
+        SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE
     } SlangcComponentTypeKind;
 
     // Component type struct - exposed so users can access it directly
@@ -27,6 +28,7 @@ extern "C"
             struct SlangcModule *module;
             struct SlangcEntryPoint *entryPoint;
             void *composite; // Opaque pointer to internal composite type
+            struct SlangcTypeConformance *typeConformance;
         };
     } SlangcComponentType;
 
@@ -35,7 +37,19 @@ extern "C"
     typedef struct SlangcSession SlangcSession;
     typedef struct SlangcModule SlangcModule;
     typedef struct SlangcEntryPoint SlangcEntryPoint;
+    typedef struct SlangcTypeConformance SlangcTypeConformance;
+    typedef struct SlangcHostCallable SlangcHostCallable;
+    typedef struct SlangcComputeDispatcher SlangcComputeDispatcher;
+    typedef struct SlangcDependencyGraph SlangcDependencyGraph;
+    typedef struct SlangcHotReload SlangcHotReload;
     typedef struct SlangcBlob SlangcBlob;
+    typedef struct SlangcCache SlangcCache;
+    typedef struct SlangcSessionPool SlangcSessionPool;
+    typedef struct SlangcCompileExecutor SlangcCompileExecutor;
+    typedef struct SlangcCompileTicket SlangcCompileTicket;
+    typedef struct SlangcCompileServer SlangcCompileServer;
+    typedef struct SlangcFileSystem SlangcFileSystem;
+    typedef struct SlangcProfile SlangcProfile;
 
     // Result codes (still useful for some functions)
     typedef int32_t SlangcResult;
@@ -136,11 +150,15 @@ extern "C"
     {
         SlangcCompileTarget *targets;
         int32_t targetCount;
-        const char **searchPaths;
+        const char **searchPaths;        // Paths searched for imported modules and includes
         int32_t searchPathCount;
-        const char **preprocessorMacros;
+        const char **preprocessorMacros; // Macros as "NAME" or "NAME=VALUE"
         int32_t preprocessorMacroCount;
         SlangcMatrixLayoutMode matrixLayoutMode;
+        SlangcCache *cache;           // Optional compiled-code cache (can be NULL)
+        SlangcFileSystem *fileSystem; // Optional file system for source loading (NULL for Slang's default)
+        SlangcProfile *timingProfile; // Optional timing profile to record calls into (can be NULL)
+        bool generateWholeProgram;    // Generate one module per target holding every entry point (see slangc_getTargetCode)
     } SlangcSessionDesc;
 
     // Global session description
@@ -150,8 +168,391 @@ extern "C"
         const char **searchPaths;
         int32_t searchPathCount;
         bool enableGLSL;
+        const char *coreModuleSnapshotPath; // Core module snapshot file (can be NULL to always build the core module)
     } SlangcGlobalSessionDesc;
 
+    // Session pool description
+    typedef struct SlangcSessionPoolDesc
+    {
+        int32_t maxGlobalSessions;                         // Upper bound on global sessions (0 for one per hardware thread)
+        const SlangcGlobalSessionDesc *globalSessionDesc; // Settings for each global session (can be NULL for defaults)
+    } SlangcSessionPoolDesc;
+
+    // Compiled-code cache description
+    typedef struct SlangcCacheDesc
+    {
+        const char *directory; // Directory holding cache entries (created if missing)
+        uint64_t maxSizeBytes; // Size cap before least recently used entries are evicted (0 for no cap)
+        bool cacheModules;     // Also keep checked modules loaded through slangc_loadModule
+    } SlangcCacheDesc;
+
+    // File system description
+    typedef struct SlangcFileSystemDesc
+    {
+        const char *archivePath; // Packed archive to serve files from (can be NULL)
+        bool disableOSFiles;     // Serve only files found in the archive
+    } SlangcFileSystemDesc;
+
+    // Wrapper calls timed by a profile
+    typedef enum SlangcProfilePhase
+    {
+        SLANGC_PROFILE_PHASE_LOAD_MODULE,          // slangc_loadModule and slangc_loadModuleFromSource*
+        SLANGC_PROFILE_PHASE_FIND_ENTRY_POINT,     // slangc_findEntryPoint
+        SLANGC_PROFILE_PHASE_CREATE_COMPOSITE,     // slangc_createCompositeComponentType
+        SLANGC_PROFILE_PHASE_LINK,                 // slangc_linkComponentType
+        SLANGC_PROFILE_PHASE_GET_ENTRY_POINT_CODE, // slangc_getEntryPointCode
+        SLANGC_PROFILE_PHASE_GET_TARGET_CODE,      // slangc_getTargetCode
+        SLANGC_PROFILE_PHASE_SPECIALIZE,           // slangc_specialize
+        SLANGC_PROFILE_PHASE_GET_HOST_CALLABLE,    // slangc_getEntryPointHostCallable
+        SLANGC_PROFILE_PHASE_COUNT
+    } SlangcProfilePhase;
+
+    // Accumulated timing of one phase
+    typedef struct SlangcProfilePhaseStats
+    {
+        uint64_t callCount;
+        double wallSeconds;       // Elapsed time inside the calls
+        double cpuSeconds;        // CPU time of the calling threads inside the calls
+        double compilerSeconds;   // Time Slang reports for itself, including downstream compilers
+        double downstreamSeconds; // Time Slang reports for downstream compilers such as DXC or glslang
+    } SlangcProfilePhaseStats;
+
+    // One entry of Slang's performance benchmark report
+    typedef struct SlangcProfileBenchmarkEntry
+    {
+        const char *name; // Slang function or pass name (valid until the profile is reset or released)
+        uint64_t invocationCount;
+        double milliseconds;
+    } SlangcProfileBenchmarkEntry;
+
+    // A single entry point compilation in a batch
+    typedef struct SlangcCompileJob
+    {
+        const char *moduleName;          // Module to load, as passed to slangc_loadModule
+        const char *entryPointName;      // Entry point function name
+        SlangcStage stage;               // Entry point stage
+        SlangcCompileTarget target;      // Code generation target
+        const char **preprocessorMacros; // Macros as "NAME" or "NAME=VALUE" (can be NULL)
+        int32_t preprocessorMacroCount;
+        const char *depfilePath;         // Makefile depfile written after a successful compile (can be NULL)
+        const char *outputPath;          // Rule target named in the depfile (NULL for the entry point name)
+    } SlangcCompileJob;
+
+    // Result of a single batch job
+    typedef struct SlangcCompileJobResult
+    {
+        SlangcResult result;     // SLANGC_OK if code was produced
+        SlangcBlob *code;        // Compiled code, or NULL on failure
+        SlangcBlob *diagnostics; // Diagnostic messages, or NULL if there were none
+    } SlangcCompileJobResult;
+
+    // Batch compilation description
+    typedef struct SlangcBatchDesc
+    {
+        SlangcSessionPool *pool; // Pool to take global sessions from (NULL for a temporary pool)
+        int32_t threadCount;     // Worker threads (0 for one per hardware thread)
+        const char **searchPaths;
+        int32_t searchPathCount;
+        SlangcMatrixLayoutMode matrixLayoutMode;
+        SlangcCache *cache;           // Optional compiled-code cache (can be NULL)
+        SlangcFileSystem *fileSystem; // Optional file system for source loading (NULL for Slang's default)
+        SlangcProfile *timingProfile; // Optional timing profile to record calls into (can be NULL)
+    } SlangcBatchDesc;
+
+    // A preprocessor macro that takes one of several values in each permutation variant
+    typedef struct SlangcMacroDimension
+    {
+        const char *name;    // Macro name
+        const char **values; // Values to enumerate (a NULL value leaves the macro undefined)
+        int32_t valueCount;
+    } SlangcMacroDimension;
+
+    // Called for each enumerated variant with one value index per dimension; return
+    // false to prune the variant
+    typedef bool (*SlangcPermutationFilter)(const int32_t *valueIndices, int32_t dimensionCount, void *userData);
+
+    // Permutation compilation description
+    typedef struct SlangcPermutationDesc
+    {
+        const char *moduleName;     // Module to load, as passed to slangc_loadModule
+        const char *entryPointName; // Entry point function name
+        SlangcStage stage;          // Entry point stage
+        SlangcCompileTarget target; // Code generation target
+        const SlangcMacroDimension *dimensions;
+        int32_t dimensionCount;
+        const char **preprocessorMacros; // Macros shared by every variant; a dimension replaces one of the same name (can be NULL)
+        int32_t preprocessorMacroCount;
+        SlangcPermutationFilter filter; // Optional pruning rule (NULL to keep every variant)
+        void *filterUserData;
+    } SlangcPermutationDesc;
+
+    // Compiled permutation variants, with identical outputs stored once
+    typedef struct SlangcPermutationResults
+    {
+        int32_t variantCount;     // Variants left after pruning
+        int32_t dimensionCount;
+        int32_t *valueIndices;    // variantCount rows of dimensionCount value indices
+        SlangcResult *results;    // Per variant result
+        int32_t *blobIndices;     // Per variant index into blobs, or -1 if the variant failed
+        SlangcBlob **diagnostics; // Per variant diagnostics (entries can be NULL)
+        int32_t blobCount;        // Number of unique outputs
+        SlangcBlob **blobs;       // Unique compiled outputs
+    } SlangcPermutationResults;
+
+    // Asynchronous compile executor description
+    typedef struct SlangcCompileExecutorDesc
+    {
+        SlangcSessionPool *pool; // Pool to take global sessions from (NULL for an executor-owned pool)
+        int32_t threadCount;     // Background threads (0 for one less than the hardware thread count)
+        const char **searchPaths;
+        int32_t searchPathCount;
+        SlangcMatrixLayoutMode matrixLayoutMode;
+        SlangcCache *cache;           // Optional compiled-code cache (can be NULL)
+        SlangcFileSystem *fileSystem; // Optional file system for source loading (NULL for Slang's default)
+        SlangcProfile *timingProfile; // Optional timing profile to record calls into (can be NULL)
+    } SlangcCompileExecutorDesc;
+
+    // State of an asynchronous compile
+    typedef enum SlangcCompileTicketStatus
+    {
+        SLANGC_COMPILE_TICKET_PENDING = 0,
+        SLANGC_COMPILE_TICKET_RUNNING,
+        SLANGC_COMPILE_TICKET_SUCCEEDED,
+        SLANGC_COMPILE_TICKET_FAILED,
+        SLANGC_COMPILE_TICKET_CANCELLED
+    } SlangcCompileTicketStatus;
+
+    // Called on an executor thread once a ticket has finished or was cancelled
+    typedef void (*SlangcCompileCallback)(SlangcCompileTicket *ticket, void *userData);
+
+#define SLANGC_WAIT_INFINITE 0xFFFFFFFFu
+
+    // Compile server description
+    typedef struct SlangcCompileServerDesc
+    {
+        const char *socketPath;  // Unix domain socket to listen on (NULL for the default, see slangc_compileBatchRemote)
+        SlangcSessionPool *pool; // Pool to take global sessions from (NULL for a server-owned pool)
+        int32_t threadCount;     // Compile threads for each set of session settings (0 for one per hardware thread)
+        SlangcCache *cache;      // Optional compiled-code cache (can be NULL)
+        int32_t maxExecutors;    // Sets of session settings kept warm at once, least recently used evicted first (0 for 4)
+    } SlangcCompileServerDesc;
+
+    // Compiled-code cache statistics
+    typedef struct SlangcCacheStats
+    {
+        uint64_t hitCount;        // Entry point code served from the cache
+        uint64_t missCount;       // Entry point code that had to be generated
+        uint64_t moduleHitCount;  // Modules loaded from an up-to-date binary module
+        uint64_t moduleMissCount; // Modules that had to be checked from source
+        uint64_t evictionCount;
+        uint64_t entryCount;
+        uint64_t totalSizeBytes;
+    } SlangcCacheStats;
+
+    // Compile server statistics
+    typedef struct SlangcCompileServerStats
+    {
+        uint64_t requestCount;            // Batches received from clients
+        uint64_t jobCount;                // Jobs in those batches
+        uint64_t rejectedConnectionCount; // Connections closed because the peer was another user
+    } SlangcCompileServerStats;
+
+    // Parameter resource categories (values match SlangParameterCategory)
+    typedef enum SlangcParameterCategory
+    {
+        SLANGC_PARAMETER_CATEGORY_NONE = 0,
+        SLANGC_PARAMETER_CATEGORY_MIXED,
+        SLANGC_PARAMETER_CATEGORY_CONSTANT_BUFFER,
+        SLANGC_PARAMETER_CATEGORY_SHADER_RESOURCE,
+        SLANGC_PARAMETER_CATEGORY_UNORDERED_ACCESS,
+        SLANGC_PARAMETER_CATEGORY_VARYING_INPUT,
+        SLANGC_PARAMETER_CATEGORY_VARYING_OUTPUT,
+        SLANGC_PARAMETER_CATEGORY_SAMPLER_STATE,
+        SLANGC_PARAMETER_CATEGORY_UNIFORM,
+        SLANGC_PARAMETER_CATEGORY_DESCRIPTOR_TABLE_SLOT,
+        SLANGC_PARAMETER_CATEGORY_SPECIALIZATION_CONSTANT,
+        SLANGC_PARAMETER_CATEGORY_PUSH_CONSTANT_BUFFER,
+        SLANGC_PARAMETER_CATEGORY_REGISTER_SPACE,
+        SLANGC_PARAMETER_CATEGORY_GENERIC,
+        SLANGC_PARAMETER_CATEGORY_RAY_PAYLOAD,
+        SLANGC_PARAMETER_CATEGORY_HIT_ATTRIBUTES,
+        SLANGC_PARAMETER_CATEGORY_CALLABLE_PAYLOAD,
+        SLANGC_PARAMETER_CATEGORY_SHADER_RECORD,
+        SLANGC_PARAMETER_CATEGORY_EXISTENTIAL_TYPE_PARAM,
+        SLANGC_PARAMETER_CATEGORY_EXISTENTIAL_OBJECT_PARAM,
+        SLANGC_PARAMETER_CATEGORY_SUB_ELEMENT_REGISTER_SPACE,
+        SLANGC_PARAMETER_CATEGORY_SUBPASS
+    } SlangcParameterCategory;
+
+    // Descriptor binding types (values match SlangBindingType)
+    typedef enum SlangcBindingType
+    {
+        SLANGC_BINDING_TYPE_UNKNOWN = 0,
+        SLANGC_BINDING_TYPE_SAMPLER,
+        SLANGC_BINDING_TYPE_TEXTURE,
+        SLANGC_BINDING_TYPE_CONSTANT_BUFFER,
+        SLANGC_BINDING_TYPE_PARAMETER_BLOCK,
+        SLANGC_BINDING_TYPE_TYPED_BUFFER,
+        SLANGC_BINDING_TYPE_RAW_BUFFER,
+        SLANGC_BINDING_TYPE_COMBINED_TEXTURE_SAMPLER,
+        SLANGC_BINDING_TYPE_INPUT_RENDER_TARGET,
+        SLANGC_BINDING_TYPE_INLINE_UNIFORM_DATA,
+        SLANGC_BINDING_TYPE_RAY_TRACING_ACCELERATION_STRUCTURE,
+        SLANGC_BINDING_TYPE_VARYING_INPUT,
+        SLANGC_BINDING_TYPE_VARYING_OUTPUT,
+        SLANGC_BINDING_TYPE_EXISTENTIAL_VALUE,
+        SLANGC_BINDING_TYPE_PUSH_CONSTANT,
+        SLANGC_BINDING_TYPE_MUTABLE_FLAG = 0x100,
+        SLANGC_BINDING_TYPE_MUTABLE_TEXTURE = 0x102,
+        SLANGC_BINDING_TYPE_MUTABLE_TYPED_BUFFER = 0x105,
+        SLANGC_BINDING_TYPE_MUTABLE_RAW_BUFFER = 0x106
+    } SlangcBindingType;
+
+    // Type kinds (values match SlangTypeKind)
+    typedef enum SlangcTypeKind
+    {
+        SLANGC_TYPE_KIND_NONE = 0,
+        SLANGC_TYPE_KIND_STRUCT,
+        SLANGC_TYPE_KIND_ARRAY,
+        SLANGC_TYPE_KIND_MATRIX,
+        SLANGC_TYPE_KIND_VECTOR,
+        SLANGC_TYPE_KIND_SCALAR,
+        SLANGC_TYPE_KIND_CONSTANT_BUFFER,
+        SLANGC_TYPE_KIND_RESOURCE,
+        SLANGC_TYPE_KIND_SAMPLER_STATE,
+        SLANGC_TYPE_KIND_TEXTURE_BUFFER,
+        SLANGC_TYPE_KIND_SHADER_STORAGE_BUFFER,
+        SLANGC_TYPE_KIND_PARAMETER_BLOCK,
+        SLANGC_TYPE_KIND_GENERIC_TYPE_PARAMETER,
+        SLANGC_TYPE_KIND_INTERFACE,
+        SLANGC_TYPE_KIND_OUTPUT_STREAM,
+        SLANGC_TYPE_KIND_MESH_OUTPUT,
+        SLANGC_TYPE_KIND_SPECIALIZED,
+        SLANGC_TYPE_KIND_FEEDBACK,
+        SLANGC_TYPE_KIND_POINTER,
+        SLANGC_TYPE_KIND_DYNAMIC_RESOURCE
+    } SlangcTypeKind;
+
+#define SLANGC_REFLECTION_MAGIC 0x46455253u // "SREF"
+#define SLANGC_REFLECTION_VERSION 2u
+
+    // Header of a reflection snapshot. The snapshot is one contiguous, pointer-free
+    // buffer: every array field is a byte offset from the start of the header to an
+    // array aligned to its element size (4 bytes, or 8 for hashes), and every string is
+    // a byte offset into the string table of a null-terminated UTF-8 string. Entry
+    // point indices of -1 mean global scope.
+    //
+    // Layout hashes are canonical: they cover the binding index, descriptor type and
+    // count and stage mask of every range in a set, sorted by binding, and ignore
+    // names and declaration order. Equal layoutHash values mean the programs can share
+    // a pipeline layout.
+    typedef struct SlangcReflectionSnapshot
+    {
+        uint32_t magic;   // SLANGC_REFLECTION_MAGIC
+        uint32_t version; // SLANGC_REFLECTION_VERSION
+        uint32_t totalSize;
+        uint32_t entryPointCount;
+        uint32_t parameterCount;
+        uint32_t bindingCount;
+        uint32_t pushConstantCount;
+        uint32_t stringTableSize;
+        uint64_t layoutHash; // Hash of every descriptor set layout and push-constant range
+        uint32_t setCount;   // Distinct descriptor sets used by the bindings
+
+        // Entry points
+        uint32_t entryPointNames;            // uint32_t string offsets
+        uint32_t entryPointStages;           // uint32_t SlangcStage
+        uint32_t entryPointThreadGroupSizes; // uint32_t[3] per entry point
+
+        // Top-level shader parameters, global then per entry point
+        uint32_t parameterNames;         // uint32_t string offsets
+        uint32_t parameterTypeNames;     // uint32_t string offsets
+        uint32_t parameterTypeKinds;     // uint32_t SlangcTypeKind
+        uint32_t parameterCategories;    // uint32_t SlangcParameterCategory
+        uint32_t parameterEntryPoints;   // int32_t entry point index
+        uint32_t parameterSpaces;        // uint32_t register space / descriptor set
+        uint32_t parameterOffsets;       // uint32_t offset in category units (bytes for uniforms)
+        uint32_t parameterSizes;         // uint32_t size in category units
+        uint32_t parameterElementCounts; // uint32_t array length (1 if not an array, 0 if unbounded)
+        uint32_t parameterDataSizes;     // uint32_t uniform bytes (buffer contents for constant buffers)
+
+        // Descriptor ranges, as used to build descriptor set layouts
+        uint32_t bindingSets;             // uint32_t descriptor set / register space
+        uint32_t bindingIndices;          // uint32_t binding / register index
+        uint32_t bindingDescriptorCounts; // uint32_t descriptors in the range (0 if unbounded)
+        uint32_t bindingTypes;            // uint32_t SlangcBindingType
+        uint32_t bindingCategories;       // uint32_t SlangcParameterCategory
+        uint32_t bindingEntryPoints;      // int32_t entry point index
+        uint32_t bindingStageMasks;       // uint32_t stage bits (1 << SlangcStage)
+
+        // Descriptor sets
+        uint32_t setIndices; // uint32_t descriptor set numbers, ascending
+        uint32_t setHashes;  // uint64_t canonical layout hash (8-byte aligned)
+
+        // Push-constant ranges
+        uint32_t pushConstantSizes;       // uint32_t size in bytes
+        uint32_t pushConstantEntryPoints; // int32_t entry point index
+        uint32_t pushConstantParameters;  // uint32_t index into the parameter arrays
+        uint32_t pushConstantStageMasks;  // uint32_t stage bits (1 << SlangcStage)
+        uint32_t pushConstantHashes;      // uint64_t canonical range hash (8-byte aligned)
+
+        uint32_t stringTable;
+    } SlangcReflectionSnapshot;
+
+    // Outputs affected by changed source files
+    typedef struct SlangcInvalidation
+    {
+        int32_t outputCount;
+        const char **outputNames; // Outputs that must be rebuilt, as passed to slangc_recordDependencies
+        int32_t moduleCount;
+        const char **moduleNames; // Modules those outputs were built from
+        int32_t entryPointCount;
+        const char **entryPointNames;     // Entry points those outputs contain, once per output
+        const int32_t *entryPointOutputs; // Index into outputNames of the output each entry point is in
+    } SlangcInvalidation;
+
+    // Called on the hot-reload thread each time a watched entry point is compiled. The
+    // callback owns the result's blobs; release them with slangc_releaseCompileJobResults.
+    typedef void (*SlangcHotReloadCallback)(int32_t watchId, SlangcCompileJobResult *result, void *userData);
+
+    // Hot-reload service description
+    typedef struct SlangcHotReloadDesc
+    {
+        SlangcSessionPool *pool; // Pool to take a global session from (NULL for a service-owned pool)
+        const char **searchPaths;
+        int32_t searchPathCount;
+        SlangcMatrixLayoutMode matrixLayoutMode;
+        SlangcFileSystem *fileSystem;  // Optional file system for source loading; its cache is cleared on each change
+        SlangcProfile *timingProfile;  // Optional timing profile to record calls into (can be NULL)
+        uint32_t debounceMilliseconds; // Quiet time after the last write before recompiling (0 for 20 ms)
+        SlangcHotReloadCallback callback;
+        void *userData;
+    } SlangcHotReloadDesc;
+
+    // Range of workgroups run by one call of a host compute kernel
+    // (matches ComputeVaryingInput in slang-cpp-types.h)
+    typedef struct SlangcComputeVaryingInput
+    {
+        uint32_t startGroupID[3];
+        uint32_t endGroupID[3]; // Exclusive
+    } SlangcComputeVaryingInput;
+
+    // Host compute kernel exported under the entry point's name (matches ComputeFunc
+    // in slang-cpp-types.h). The uniform pointers must match the kernel's layout.
+    typedef void (*SlangcComputeFunc)(
+        SlangcComputeVaryingInput *varyingInput,
+        void *uniformEntryPointParams,
+        void *uniformState);
+
+    // Compute grid to run on the CPU
+    typedef struct SlangcDispatchDesc
+    {
+        SlangcComputeFunc function;    // Kernel from slangc_findHostCallableFunction
+        uint32_t groupCount[3];        // Workgroups along each axis
+        void *uniformEntryPointParams; // Entry point uniform parameters (can be NULL)
+        void *uniformState;            // Global uniform state (can be NULL)
+    } SlangcDispatchDesc;
+
     //
     // Global Session Management
     //
@@ -162,6 +563,10 @@ extern "C"
     SlangcGlobalSession *slangc_createGlobalSession(void);
 
     /** Create a global session with custom settings.
+     *
+     * If desc->coreModuleSnapshotPath is set, the core module is loaded from that file
+     * instead of being rebuilt. A missing snapshot, or one written by a different Slang
+     * build (as reported by the build tag), is replaced with a freshly saved one.
      * @param desc Description of the global session configuration
      * @return Pointer to the created global session, or NULL on failure
      */
@@ -169,6 +574,7 @@ extern "C"
         const SlangcGlobalSessionDesc *desc);
 
     /** Release a global session and free its resources.
+     * Global sessions acquired from a pool must be returned with slangc_returnGlobalSession instead.
      * @param globalSession The global session to release
      */
     void slangc_releaseGlobalSession(SlangcGlobalSession *globalSession);
@@ -180,6 +586,47 @@ extern "C"
      */
     SlangcProfileID slangc_findProfile(SlangcGlobalSession *globalSession, const char *name);
 
+    //
+    // Session Pool
+    //
+
+    /** Create a pool of global sessions for compiling on several threads.
+     *
+     * A global session, and every session, module, entry point, component type and
+     * blob created from it, must only be used by one thread at a time. The pool hands
+     * each global session to one thread at a time, so threads that only use objects
+     * created from the global session they currently hold never share Slang state.
+     * Global sessions are created lazily on first demand and reused afterwards.
+     * @param desc Pool description (can be NULL for defaults)
+     * @return Pointer to the created pool, or NULL on failure
+     */
+    SlangcSessionPool *slangc_createSessionPool(const SlangcSessionPoolDesc *desc);
+
+    /** Release a session pool and every global session it owns.
+     * All acquired global sessions must have been returned first.
+     * @param pool The pool to release
+     */
+    void slangc_releaseSessionPool(SlangcSessionPool *pool);
+
+    /** Acquire a global session for exclusive use by the calling thread.
+     *
+     * Reuses an idle global session (preferring the one this thread held last),
+     * creates a new one if the pool is below its limit, or blocks until another
+     * thread returns one. Do not pass the result to slangc_releaseGlobalSession.
+     * @param pool The session pool
+     * @return Pointer to the acquired global session, or NULL on failure
+     */
+    SlangcGlobalSession *slangc_acquireGlobalSession(SlangcSessionPool *pool);
+
+    /** Return an acquired global session to its pool.
+     * Objects created from it may only be used again after it has been re-acquired.
+     * @param pool The session pool
+     * @param globalSession The global session to return
+     * @return SLANGC_OK on success, or SLANGC_E_INVALID_ARG if the session is not from this pool
+     *         or is not checked out (e.g. returned twice)
+     */
+    SlangcResult slangc_returnGlobalSession(SlangcSessionPool *pool, SlangcGlobalSession *globalSession);
+
     //
     // Session Management
     //
@@ -204,11 +651,188 @@ extern "C"
         SlangcProfileID profile,
         const SlangcSessionDesc *desc);
 
+    /** Find a session with identical settings, or create one.
+     *
+     * Sessions are shared per global session. Two descriptions match when their targets,
+     * search paths, matrix layout, cache and macro sets are equal; macro sets are compared
+     * by name and value regardless of order. Each call must be paired with
+     * slangc_releaseSession, and the session is destroyed by the last release. Sessions
+     * still alive when their global session is released stop being shared but stay valid.
+     * @param globalSession The global session
+     * @param desc Session description (can be NULL for defaults)
+     * @return Pointer to the shared session, or NULL on failure
+     */
+    SlangcSession *slangc_findOrCreateSession(
+        SlangcGlobalSession *globalSession,
+        const SlangcSessionDesc *desc);
+
+    /** Get the fingerprint of a session's macro set.
+     * Sessions created with the same macros, in any order, have the same fingerprint.
+     * @param session The session
+     * @return 64-bit hash of the canonical macro set, or 0 if session is NULL
+     */
+    uint64_t slangc_getSessionMacroFingerprint(SlangcSession *session);
+
     /** Release a session and free its resources.
      * @param session The session to release
      */
     void slangc_releaseSession(SlangcSession *session);
 
+    //
+    // Compiled-Code Cache
+    //
+
+    /** Create a persistent on-disk cache for compiled entry point code.
+     *
+     * Entries are keyed by the entry point hash reported by Slang, which covers the
+     * program's dependencies and the target options. Attach the cache to a session
+     * through SlangcSessionDesc::cache; slangc_getEntryPointCode will then consult it
+     * before running code generation. The cache may be shared by several sessions and
+     * must outlive every session it is attached to.
+     *
+     * With cacheModules set, slangc_loadModule also keeps each checked module, and the
+     * modules it imports, as a serialized binary module. A later load in any session
+     * with the same settings (targets, profile, search paths, macros and file system)
+     * validates the entry with ISession::isBinaryModuleUpToDate and loads it instead of
+     * parsing and checking the source again; stale entries fall
+     * back to the source and are replaced. Modules loaded from source text are not kept.
+     * @param desc Cache description
+     * @return Pointer to the created cache, or NULL on failure
+     */
+    SlangcCache *slangc_createCache(const SlangcCacheDesc *desc);
+
+    /** Release a cache. Entries already written stay on disk.
+     * @param cache The cache to release
+     */
+    void slangc_releaseCache(SlangcCache *cache);
+
+    /** Get the statistics of a cache.
+     * @param cache The cache to query
+     * @param outStats Pointer to receive the statistics
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_getCacheStats(SlangcCache *cache, SlangcCacheStats *outStats);
+
+    //
+    // File System
+    //
+
+    /** Create a file system for loading module sources.
+     *
+     * The results of file loads and path lookups are cached by path, so a module
+     * imported by many others is only read once. When an archive is given, files
+     * stored in it are served from a single memory mapping of the archive before
+     * falling back to the OS; the archive must not be modified while the file system
+     * is alive. Files from the OS are copied, so editing them in place is safe.
+     * Attach the file system to a session through SlangcSessionDesc::fileSystem; it
+     * may be shared by several sessions and released while they are still alive.
+     * @param desc File system description (can be NULL for defaults)
+     * @return Pointer to the created file system, or NULL on failure
+     */
+    SlangcFileSystem *slangc_createFileSystem(const SlangcFileSystemDesc *desc);
+
+    /** Release a file system.
+     * @param fileSystem The file system to release
+     */
+    void slangc_releaseFileSystem(SlangcFileSystem *fileSystem);
+
+    /** Drop every cached file and path lookup, so later loads see changes on disk.
+     * Sources already loaded by a session are not affected.
+     * @param fileSystem The file system to clear
+     */
+    void slangc_clearFileSystemCache(SlangcFileSystem *fileSystem);
+
+    /** Pack files into an archive for SlangcFileSystemDesc::archivePath.
+     *
+     * Each file is stored under its normalized path as given, so pass the paths the
+     * way Slang will request them: a search path joined with the imported file name.
+     * @param archivePath Path of the archive to write
+     * @param filePaths Paths of the files to pack
+     * @param fileCount Number of files
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_writeFileSystemArchive(
+        const char *archivePath,
+        const char **filePaths,
+        int32_t fileCount);
+
+    //
+    // Compile Profiling
+    //
+
+    /** Create a timing profile.
+     *
+     * Attach the profile to a session through SlangcSessionDesc::timingProfile to record
+     * the wall and CPU time of every module load, entry point lookup, composite creation,
+     * link and code generation made through that session. Sessions with a profile also
+     * enable Slang's downstream time and performance benchmark reports; these are taken
+     * out of the diagnostics and recorded in the profile instead. A profile may be shared
+     * by several sessions and threads, and must outlive every session it is attached to.
+     * @return Pointer to the created profile, or NULL on failure
+     */
+    SlangcProfile *slangc_createProfile(void);
+
+    /** Release a timing profile.
+     * @param profile The profile to release
+     */
+    void slangc_releaseProfile(SlangcProfile *profile);
+
+    /** Clear every recorded time and benchmark entry.
+     * @param profile The profile to reset
+     */
+    void slangc_resetProfile(SlangcProfile *profile);
+
+    /** Get the accumulated timing of one phase.
+     * @param profile The profile to query
+     * @param phase The phase to query
+     * @param outStats Pointer to receive the statistics
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_getProfilePhaseStats(
+        SlangcProfile *profile,
+        SlangcProfilePhase phase,
+        SlangcProfilePhaseStats *outStats);
+
+    /** Get the number of entries captured from Slang's performance benchmark reports.
+     * @param profile The profile to query
+     * @return Number of entries, or 0 if the profile is invalid
+     */
+    int32_t slangc_getProfileBenchmarkEntryCount(SlangcProfile *profile);
+
+    /** Get an entry captured from Slang's performance benchmark reports. Entries with the
+     * same name are accumulated over every report.
+     * @param profile The profile to query
+     * @param index Entry index, from 0 to slangc_getProfileBenchmarkEntryCount - 1
+     * @param outEntry Pointer to receive the entry
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_getProfileBenchmarkEntry(
+        SlangcProfile *profile,
+        int32_t index,
+        SlangcProfileBenchmarkEntry *outEntry);
+
+    //
+    // Tracing
+    //
+
+    /** Start recording compile activity on every thread.
+     *
+     * While a trace runs, each module load, entry point lookup, composite creation, link
+     * and code generation is recorded with its module name, entry point name, target and
+     * thread. Events go to a fixed-size buffer per thread; when a buffer is full its oldest
+     * events are overwritten. Tracing costs a single flag check per call when not running.
+     * @param eventsPerThread Events kept per thread (0 for 65536)
+     * @return SLANGC_OK on success, or SLANGC_FAIL if a trace is already running
+     */
+    SlangcResult slangc_beginTrace(uint32_t eventsPerThread);
+
+    /** Stop recording and write the trace as Chrome trace-event JSON, which can be
+     * opened in chrome://tracing or Perfetto.
+     * @param outputPath Path of the JSON file to write (can be NULL to discard the trace)
+     * @return SLANGC_OK on success, or SLANGC_FAIL if no trace is running or writing failed
+     */
+    SlangcResult slangc_endTrace(const char *outputPath);
+
     //
     // Module Loading
     //
@@ -225,6 +849,10 @@ extern "C"
         SlangcBlob **outDiagnostics);
 
     /** Load a module from source code.
+     *
+     * The source text is not copied. Slang keeps referring to it for diagnostics, so the
+     * buffer must stay valid until the session is released. Use
+     * slangc_loadModuleFromSourceBuffer to hand the buffer over instead.
      * @param session The compilation session
      * @param moduleName The name to give the module
      * @param path The file path (for error reporting)
@@ -241,6 +869,28 @@ extern "C"
         size_t sourceSize,
         SlangcBlob **outDiagnostics);
 
+    /** Load a module from an in-memory source buffer without copying it.
+     * @param session The compilation session
+     * @param moduleName The name to give the module
+     * @param path The file path (for error reporting)
+     * @param sourceText The source code text
+     * @param sourceSize The size of the source code (or 0 if null-terminated)
+     * @param takeOwnership If true, sourceText must have been allocated with malloc and is
+     *                      freed with free once Slang no longer needs it, whether or not the
+     *                      call succeeds. If false, the buffer must stay valid until the
+     *                      session is released.
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return Pointer to the loaded module, or NULL on failure
+     */
+    SlangcModule *slangc_loadModuleFromSourceBuffer(
+        SlangcSession *session,
+        const char *moduleName,
+        const char *path,
+        const char *sourceText,
+        size_t sourceSize,
+        bool takeOwnership,
+        SlangcBlob **outDiagnostics);
+
     /** Release a module.
      * @param module The module to release
      */
@@ -268,6 +918,12 @@ extern "C"
      */
     SlangcEntryPoint *slangc_getComponentTypeEntryPoint(SlangcComponentType *componentType);
 
+    /** Get the underlying type conformance from a type conformance component type.
+     * @param componentType The component type (must be SLANGC_COMPONENT_TYPE_TYPE_CONFORMANCE)
+     * @return Pointer to the type conformance, or NULL if not a type conformance component type
+     */
+    SlangcTypeConformance *slangc_getComponentTypeTypeConformance(SlangcComponentType *componentType);
+
     /** Create a composite component type from multiple components.
      * @param session The compilation session
      * @param componentTypes Array of component type structs to combine
@@ -299,6 +955,29 @@ extern "C"
      */
     void slangc_releaseEntryPoint(SlangcEntryPoint *entryPoint);
 
+    /** Declare that a type conforms to an interface, for linking dynamic dispatch code.
+     *
+     * Adding type conformances to a composite limits the dynamic dispatch code for an
+     * interface to the listed types instead of every conforming type in scope.
+     * @param module Module in which to look up the type names
+     * @param typeName The conforming type, e.g. "Wood" or "Layered<Wood, Metal>"
+     * @param interfaceName The interface type
+     * @param conformanceId Dispatch ID for the type, or -1 to let Slang assign one
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return Pointer to the type conformance, or NULL on failure
+     */
+    SlangcTypeConformance *slangc_createTypeConformance(
+        SlangcModule *module,
+        const char *typeName,
+        const char *interfaceName,
+        int32_t conformanceId,
+        SlangcBlob **outDiagnostics);
+
+    /** Release a type conformance.
+     * @param typeConformance The type conformance to release
+     */
+    void slangc_releaseTypeConformance(SlangcTypeConformance *typeConformance);
+
     /** Create a component type from a module.
      * @param module The module to wrap as a component type
      * @return Pointer to the component type, or NULL on failure
@@ -311,6 +990,12 @@ extern "C"
      */
     SlangcComponentType *slangc_createEntryPointComponentType(SlangcEntryPoint *entryPoint);
 
+    /** Create a component type from a type conformance.
+     * @param typeConformance The type conformance to wrap as a component type
+     * @return Pointer to the component type, or NULL on failure
+     */
+    SlangcComponentType *slangc_createTypeConformanceComponentType(SlangcTypeConformance *typeConformance);
+
     /** Link a component type to produce a linked program.
      * @param componentType The component type to link
      * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
@@ -320,7 +1005,30 @@ extern "C"
         SlangcComponentType *componentType,
         SlangcBlob **outDiagnostics);
 
+    /** Specialize the generic and interface-typed parameters of a component type.
+     *
+     * Each argument is a type name as written in Slang. Generic applications such as
+     * "LayeredMaterial<Wood, Metal>" are resolved with their arguments specialized in
+     * turn. The result is cached in the owning session by component and arguments, so
+     * repeating a specialization reuses the earlier component type and produces no
+     * diagnostics; the cache lives until the session is released.
+     * @param componentType The component type to specialize (a module, entry point or composite)
+     * @param typeArgumentNames Type names, one per specialization parameter in order
+     * @param typeArgumentCount Number of type names
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return Pointer to the specialized component type, or NULL on failure
+     */
+    SlangcComponentType *slangc_specialize(
+        SlangcComponentType *componentType,
+        const char **typeArgumentNames,
+        int32_t typeArgumentCount,
+        SlangcBlob **outDiagnostics);
+
     /** Get entry point code for a specific entry point and target.
+     *
+     * If the owning session has a cache attached, the cache is searched before
+     * running code generation and the result is stored in it afterwards. No
+     * diagnostics are produced for a cache hit.
      * @param componentType The component type to compile (must be fully linked)
      * @param entryPointIndex The entry point index (0-based). For simple cases with one entry point, use 0.
      *                        For composite types, this corresponds to the order entry points were added.
@@ -334,11 +1042,483 @@ extern "C"
         int32_t targetIndex,
         SlangcBlob **outDiagnostics);
 
+    /** Get the code for every entry point of a program on one target.
+     *
+     * One code generation pass emits a single module containing all entry points, e.g.
+     * one SPIR-V module for a vertex and fragment pair, instead of one pass per entry
+     * point. The session must have been created with generateWholeProgram set, and the
+     * target must support several entry points per module (SPIR-V, DXIL, Metal, etc.).
+     * The compiled-code cache is not consulted.
+     * @param componentType The component type to compile (must be fully linked)
+     * @param targetIndex The target index (0-based, from session targets)
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return Pointer to the compiled code blob, or NULL on failure
+     */
+    SlangcBlob *slangc_getTargetCode(
+        SlangcComponentType *componentType,
+        int32_t targetIndex,
+        SlangcBlob **outDiagnostics);
+
     /** Release a component type.
      * @param componentType The component type to release
      */
     void slangc_releaseComponentType(SlangcComponentType *componentType);
 
+    //
+    // Reflection
+    //
+
+    /** Capture the layout of a program as a flat reflection snapshot.
+     *
+     * The layout is walked once and written to a single buffer that starts with a
+     * SlangcReflectionSnapshot header. The buffer holds no pointers, so it can be
+     * copied with memcpy or stored next to the compiled code and read back later.
+     * @param componentType The component type to reflect (usually a linked program)
+     * @param targetIndex The target index (0-based, from session targets)
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return Blob holding the snapshot, or NULL on failure
+     */
+    SlangcBlob *slangc_buildReflectionSnapshot(
+        SlangcComponentType *componentType,
+        int32_t targetIndex,
+        SlangcBlob **outDiagnostics);
+
+    /** Validate a snapshot loaded from memory or disk.
+     * @param data Snapshot bytes
+     * @param size Size of the data in bytes
+     * @return Pointer to the snapshot header, or NULL if the data is not a valid snapshot
+     */
+    const SlangcReflectionSnapshot *slangc_getReflectionSnapshot(const void *data, size_t size);
+
+    /** Group programs that can share a pipeline layout.
+     *
+     * Programs are grouped by their descriptor set and push-constant range hashes, so
+     * a pipeline layout can be created once per group.
+     * @param snapshots Array of reflection snapshots, one per linked program, each checked
+     *                  like slangc_getReflectionSnapshot against its own totalSize
+     * @param snapshotCount Number of snapshots
+     * @param outGroupIndices Array of snapshotCount entries receiving each program's
+     *                        group index. Groups are numbered in first-seen order.
+     * @return Number of distinct layouts, or -1 on failure
+     */
+    int32_t slangc_groupProgramsByLayout(
+        const SlangcReflectionSnapshot *const *snapshots,
+        int32_t snapshotCount,
+        int32_t *outGroupIndices);
+
+    /** Find which descriptor ranges compiled code actually uses.
+     *
+     * Bit i of the result is set if binding range i of the snapshot is used, so
+     * updates to unused ranges can be skipped. Slang generates the code to answer
+     * this, so compute it once per program and keep it with the snapshot.
+     * @param componentType The component type to query (must be fully linked)
+     * @param entryPointIndex The entry point index, or -1 for all entry points of the target
+     * @param targetIndex The target index (0-based, from session targets)
+     * @param snapshot Reflection snapshot built from the same component type and target,
+     *                 checked like slangc_getReflectionSnapshot against its own totalSize
+     * @param outBits Array of (snapshot->bindingCount + 31) / 32 words receiving the bits
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_getUsedBindings(
+        SlangcComponentType *componentType,
+        int32_t entryPointIndex,
+        int32_t targetIndex,
+        const SlangcReflectionSnapshot *snapshot,
+        uint32_t *outBits,
+        SlangcBlob **outDiagnostics);
+
+    //
+    // Batch Compilation
+    //
+
+    /** Compile many entry points in parallel.
+     *
+     * Jobs run on an internal work-stealing thread pool. Jobs that share a module and
+     * macro set are scheduled together, so each worker parses and checks a module once
+     * and reuses it for every entry point. Each worker holds one global session from
+     * the pool while it runs a group of jobs.
+     * @param desc Batch description
+     * @param jobs Array of jobs to compile
+     * @param jobCount Number of jobs
+     * @param outResults Array of jobCount results, filled in job order. Release the
+     *                   blobs with slangc_releaseCompileJobResults.
+     * @return SLANGC_OK if every job succeeded, or an error code if any job failed
+     */
+    SlangcResult slangc_compileBatch(
+        const SlangcBatchDesc *desc,
+        const SlangcCompileJob *jobs,
+        int32_t jobCount,
+        SlangcCompileJobResult *outResults);
+
+    /** Release the blobs held by an array of batch results.
+     * @param results The results to release
+     * @param resultCount Number of results
+     */
+    void slangc_releaseCompileJobResults(SlangcCompileJobResult *results, int32_t resultCount);
+
+    //
+    // Permutations
+    //
+
+    /** Compile every variant of an entry point across a set of macro dimensions.
+     *
+     * Variants are enumerated with the first dimension varying slowest, passed through
+     * the optional filter, and compiled in parallel with slangc_compileBatch. Outputs
+     * with identical bytes are stored once, so variants that compile to the same code
+     * share a blob index.
+     * @param desc Permutation description
+     * @param batchDesc Batch settings used to compile the variants
+     * @param outResults Filled with the variant table and unique outputs. Release with
+     *                   slangc_releasePermutationResults, even on failure.
+     * @return SLANGC_OK if every variant compiled, or an error code if any failed
+     */
+    SlangcResult slangc_compilePermutations(
+        const SlangcPermutationDesc *desc,
+        const SlangcBatchDesc *batchDesc,
+        SlangcPermutationResults *outResults);
+
+    /** Release the tables and blobs held by permutation results.
+     * @param results The results to release
+     */
+    void slangc_releasePermutationResults(SlangcPermutationResults *results);
+
+    //
+    // Asynchronous Compilation
+    //
+
+    /** Create a background executor for asynchronous compiles.
+     *
+     * The executor owns its threads and keeps the sessions and checked modules it
+     * creates warm between compiles. Before reusing a session it compares the size and
+     * modification time of every file its modules were loaded from, and loads them
+     * again if any changed. Higher priority tickets start first; tickets with
+     * equal priority start in submission order.
+     * @param desc Executor description (can be NULL for defaults)
+     * @return Pointer to the created executor, or NULL on failure
+     */
+    SlangcCompileExecutor *slangc_createCompileExecutor(const SlangcCompileExecutorDesc *desc);
+
+    /** Release an executor. Compiles already running are finished, pending tickets are
+     * cancelled, and every callback has run by the time this returns.
+     * @param executor The executor to release
+     */
+    void slangc_releaseCompileExecutor(SlangcCompileExecutor *executor);
+
+    /** Queue a compile on the executor without blocking.
+     * @param executor The executor
+     * @param job The job to compile (copied, so it need not outlive the call)
+     * @param priority Scheduling priority, higher values start first
+     * @param callback Completion callback, run on an executor thread (can be NULL)
+     * @param userData Value passed to the callback
+     * @return Ticket for the compile, or NULL on failure. Release with slangc_releaseCompileTicket.
+     */
+    SlangcCompileTicket *slangc_compileAsync(
+        SlangcCompileExecutor *executor,
+        const SlangcCompileJob *job,
+        int32_t priority,
+        SlangcCompileCallback callback,
+        void *userData);
+
+    /** Get the current state of a ticket without blocking.
+     * @param ticket The ticket
+     * @return The ticket status
+     */
+    SlangcCompileTicketStatus slangc_pollCompileTicket(SlangcCompileTicket *ticket);
+
+    /** Wait for a ticket to finish.
+     * @param ticket The ticket
+     * @param timeoutMilliseconds Maximum time to wait, or SLANGC_WAIT_INFINITE
+     * @return The ticket status when the wait ended
+     */
+    SlangcCompileTicketStatus slangc_waitCompileTicket(SlangcCompileTicket *ticket, uint32_t timeoutMilliseconds);
+
+    /** Cancel a ticket that has not started yet.
+     * @param ticket The ticket
+     * @return true if the ticket was cancelled, false if it had already started
+     */
+    bool slangc_cancelCompileTicket(SlangcCompileTicket *ticket);
+
+    /** Change the priority of a ticket that has not started yet.
+     * @param ticket The ticket
+     * @param priority New scheduling priority, higher values start first
+     * @return SLANGC_OK on success, or SLANGC_FAIL if the ticket has already started
+     */
+    SlangcResult slangc_setCompileTicketPriority(SlangcCompileTicket *ticket, int32_t priority);
+
+    /** Take the result of a finished ticket. Ownership of the blobs moves to the caller;
+     * later calls return NULL blobs.
+     * @param ticket The ticket
+     * @param outResult Pointer to receive the result
+     * @return SLANGC_OK on success, or SLANGC_FAIL if the ticket has not finished
+     */
+    SlangcResult slangc_takeCompileTicketResult(SlangcCompileTicket *ticket, SlangcCompileJobResult *outResult);
+
+    /** Get how long a finished ticket waited in the queue and how long it ran. The run
+     * time covers everything the executor thread did for the ticket: taking a global
+     * session, loading the module and generating code.
+     * @param ticket The ticket
+     * @param outQueuedMilliseconds Receives the time from submission to start (can be NULL)
+     * @param outRunMilliseconds Receives the time from start to finish (can be NULL)
+     * @return SLANGC_OK on success, or SLANGC_FAIL if the ticket has not finished or was cancelled
+     */
+    SlangcResult slangc_getCompileTicketTiming(
+        SlangcCompileTicket *ticket,
+        double *outQueuedMilliseconds,
+        double *outRunMilliseconds);
+
+    /** Release a ticket. The compile itself is not cancelled; use slangc_cancelCompileTicket for that.
+     * @param ticket The ticket to release
+     */
+    void slangc_releaseCompileTicket(SlangcCompileTicket *ticket);
+
+    //
+    // Compile Server
+    //
+
+    /** Create a compile server listening on a Unix domain socket.
+     *
+     * The server keeps global sessions, sessions and checked modules warm across
+     * requests, so clients calling slangc_compileBatchRemote skip Slang startup. Requests
+     * are served by slangc_runCompileServer. Not available on Windows.
+     *
+     * The socket's directory must belong to the current user and be writable only by
+     * them; a missing directory is created with mode 0700. The socket is created with
+     * mode 0600, and connections from other users are closed unanswered.
+     * @param desc Server description (can be NULL for defaults)
+     * @return Pointer to the created server, or NULL on failure (including when another
+     *         server already listens on the socket)
+     */
+    SlangcCompileServer *slangc_createCompileServer(const SlangcCompileServerDesc *desc);
+
+    /** Accept and serve connections until slangc_stopCompileServer is called.
+     * @param server The server
+     * @return SLANGC_OK once stopped, or an error code on failure
+     */
+    SlangcResult slangc_runCompileServer(SlangcCompileServer *server);
+
+    /** Ask a running server to stop. Safe to call from a signal handler.
+     * @param server The server
+     */
+    void slangc_stopCompileServer(SlangcCompileServer *server);
+
+    /** Release a server and remove its socket file. The server must not be running.
+     * @param server The server to release
+     */
+    void slangc_releaseCompileServer(SlangcCompileServer *server);
+
+    /** Get the statistics of a compile server. Safe to call while it is running.
+     * @param server The server to query
+     * @param outStats Pointer to receive the statistics
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_getCompileServerStats(SlangcCompileServer *server, SlangcCompileServerStats *outStats);
+
+    /** Compile a batch on a running compile server, or in process when none answers.
+     *
+     * Results match slangc_compileBatch. Search paths, depfile paths, and module names
+     * that are file paths (containing a directory or ending in .slang) and exist relative
+     * to the working directory are made absolute before forwarding; output paths are
+     * sent as written, since they only name the depfile target. Depfiles are written by
+     * the server. A server that sends nothing for 30 seconds is abandoned and the batch
+     * is compiled in process. Batches with a file system or timing profile attached are
+     * always compiled in process, and the pool and cache of the description only apply
+     * then.
+     * @param socketPath Server socket (NULL for SLANGC_SERVER_SOCKET, then
+     *                   $XDG_RUNTIME_DIR/slangc-server.sock, then /tmp/slangc-UID/server.sock).
+     *                   A socket not owned by the current user, in a directory others
+     *                   can write to, or served by another user is not used.
+     * @param desc Batch settings
+     * @param jobs Jobs to compile
+     * @param jobCount Number of jobs
+     * @param outResults Array of jobCount results to fill. Release with slangc_releaseCompileJobResults.
+     * @return SLANGC_OK if every job succeeded, or an error code if any failed
+     */
+    SlangcResult slangc_compileBatchRemote(
+        const char *socketPath,
+        const SlangcBatchDesc *desc,
+        const SlangcCompileJob *jobs,
+        int32_t jobCount,
+        SlangcCompileJobResult *outResults);
+
+    //
+    // Dependency Tracking
+    //
+
+    /** Get the number of source files a module was built from, including its imports.
+     * @param module The loaded module
+     * @return Number of dependency files, or -1 on failure
+     */
+    int32_t slangc_getModuleDependencyFileCount(SlangcModule *module);
+
+    /** Get the path of one of a module's dependency files.
+     * @param module The loaded module
+     * @param index The dependency index (0-based)
+     * @return The file path (valid while the module is loaded), or NULL on failure
+     */
+    const char *slangc_getModuleDependencyFilePath(SlangcModule *module, int32_t index);
+
+    /** Write a Makefile-syntax depfile for a compiled component type.
+     *
+     * The depfile holds one rule whose prerequisites are the dependency files of every
+     * module behind the component type, in the form Make and Ninja (deps = gcc) read.
+     * Batch jobs write one themselves when SlangcCompileJob::depfilePath is set.
+     * @param componentType The component type the output was compiled from
+     * @param targetPath The output file named as the rule target
+     * @param depfilePath The depfile to write (replaced once complete)
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_writeDepfile(SlangcComponentType *componentType, const char *targetPath, const char *depfilePath);
+
+    /** Create a graph mapping source files to the outputs built from them.
+     * @param path File the graph is loaded from if it exists, and saved to by
+     *             slangc_saveDependencyGraph (can be NULL for an in-memory graph)
+     * @return Pointer to the created graph, or NULL on failure
+     */
+    SlangcDependencyGraph *slangc_createDependencyGraph(const char *path);
+
+    /** Release a dependency graph without saving it.
+     * @param graph The graph to release
+     */
+    void slangc_releaseDependencyGraph(SlangcDependencyGraph *graph);
+
+    /** Write a dependency graph to the path it was created with.
+     * @param graph The graph to save
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_saveDependencyGraph(SlangcDependencyGraph *graph);
+
+    /** Record the modules, entry points and source files an output was built from.
+     *
+     * Any earlier record for the same output is replaced.
+     * @param graph The graph to update
+     * @param outputName Caller-chosen name for the output, e.g. the path its code is written to
+     * @param componentType The component type the output was compiled from
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_recordDependencies(
+        SlangcDependencyGraph *graph,
+        const char *outputName,
+        SlangcComponentType *componentType);
+
+    /** Find the outputs that depend on any of a set of changed files.
+     * @param graph The graph to query
+     * @param paths Changed source file paths
+     * @param pathCount Number of paths
+     * @param outInvalidation Filled with the affected outputs, modules and entry points.
+     *                        Release with slangc_releaseInvalidation.
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_invalidate(
+        SlangcDependencyGraph *graph,
+        const char **paths,
+        int32_t pathCount,
+        SlangcInvalidation *outInvalidation);
+
+    /** Release the names held by an invalidation result.
+     * @param invalidation The result to release
+     */
+    void slangc_releaseInvalidation(SlangcInvalidation *invalidation);
+
+    //
+    // Hot Reload
+    //
+
+    /** Create a service that recompiles entry points when their source files change.
+     *
+     * The service watches the directories of every file the watched entry points were
+     * built from (Linux inotify) and recompiles on a background thread once writes have
+     * been quiet for the debounce time. Only entry points that depend on a changed file
+     * are recompiled, and modules whose files did not change are reused from their
+     * checked form instead of being parsed again.
+     * An entry point whose module has never loaded is retried on any change in the
+     * working directory or search paths, and every entry point is recompiled if the
+     * kernel drops watch events.
+     * @param desc Service description (the callback is required)
+     * @return Pointer to the created service, or NULL on failure or on platforms
+     *         without inotify
+     */
+    SlangcHotReload *slangc_createHotReload(const SlangcHotReloadDesc *desc);
+
+    /** Stop watching and release a hot-reload service. A compile already running is
+     * finished and its callbacks have run by the time this returns.
+     * @param hotReload The service to release
+     */
+    void slangc_releaseHotReload(SlangcHotReload *hotReload);
+
+    /** Start watching an entry point. It is compiled once right away, and again each
+     * time one of its files changes; every compile is delivered to the callback.
+     * @param hotReload The service
+     * @param job The entry point to compile (copied)
+     * @return Watch ID passed to the callback, or -1 on failure
+     */
+    int32_t slangc_watchEntryPoint(SlangcHotReload *hotReload, const SlangcCompileJob *job);
+
+    /** Stop watching an entry point. The service thread drops it along with the
+     * directory watches and kept modules nothing else needs; a compile already running
+     * may still report it once. Unwatching the same ID twice is harmless.
+     * @param hotReload The service
+     * @param watchId Watch ID returned by slangc_watchEntryPoint
+     * @return SLANGC_OK on success, or an error code if the ID was never returned
+     */
+    SlangcResult slangc_unwatchEntryPoint(SlangcHotReload *hotReload, int32_t watchId);
+
+    //
+    // Host Execution
+    //
+
+    /** Compile an entry point for the host CPU and load it as a shared library.
+     *
+     * The session must have a SLANGC_TARGET_HOST_CALLABLE or
+     * SLANGC_TARGET_SHADER_HOST_CALLABLE target. Compute entry points are exported
+     * under their own name with the SlangcComputeFunc signature.
+     * @param componentType The component type to compile (must be fully linked)
+     * @param entryPointIndex The entry point index (0-based)
+     * @param targetIndex The target index (0-based, from session targets)
+     * @param outDiagnostics Pointer to receive diagnostic messages (can be NULL)
+     * @return Pointer to the loaded code, or NULL on failure
+     */
+    SlangcHostCallable *slangc_getEntryPointHostCallable(
+        SlangcComponentType *componentType,
+        int32_t entryPointIndex,
+        int32_t targetIndex,
+        SlangcBlob **outDiagnostics);
+
+    /** Look up an exported function in host-callable code.
+     * @param hostCallable The loaded code
+     * @param name The symbol name, e.g. the entry point name
+     * @return Function pointer, or NULL if the symbol was not found. Valid until the
+     *         host callable is released.
+     */
+    void *slangc_findHostCallableFunction(SlangcHostCallable *hostCallable, const char *name);
+
+    /** Unload host-callable code.
+     * @param hostCallable The code to release
+     */
+    void slangc_releaseHostCallable(SlangcHostCallable *hostCallable);
+
+    /** Create a thread pool for running host compute kernels.
+     * @param threadCount Worker threads (0 for one per hardware thread)
+     * @return Pointer to the created dispatcher, or NULL on failure
+     */
+    SlangcComputeDispatcher *slangc_createComputeDispatcher(int32_t threadCount);
+
+    /** Release a dispatcher. Must not be called while a dispatch is running.
+     * @param dispatcher The dispatcher to release
+     */
+    void slangc_releaseComputeDispatcher(SlangcComputeDispatcher *dispatcher);
+
+    /** Run a compute kernel over a 3D grid of workgroups and wait for it to finish.
+     *
+     * The grid is split into boxes of whole workgroups that the dispatcher's workers
+     * run in parallel, stealing boxes from each other to stay busy. The kernel must
+     * not depend on the order workgroups run in.
+     * @param dispatcher The dispatcher to run on
+     * @param desc Kernel, grid size and uniform data
+     * @return SLANGC_OK on success, or an error code on failure
+     */
+    SlangcResult slangc_dispatchCompute(SlangcComputeDispatcher *dispatcher, const SlangcDispatchDesc *desc);
+
     //
     // Blob Management
     //
@@ -0,0 +1,147 @@
+// Checks that the compile server picks up a module edited between two remote batches.
+//
+// Starts a server on a socket in a temporary directory, compiles a module through
+// slangc_compileBatchRemote, rewrites the module with a different constant and compiles
+// again. The second result must contain the new constant, not the checked module the
+// server kept from the first batch. The server's request counter must grow with each
+// batch, so an in-process fallback cannot pass the test.
+
+#include "slangc.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#define CHECK(condition)                                                                    \
+    do                                                                                      \
+    {                                                                                       \
+        if (!(condition))                                                                   \
+        {                                                                                   \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            g_failures++;                                                                   \
+        }                                                                                   \
+    } while (0)
+
+namespace
+{
+    int g_failures = 0;
+
+    void writeModule(const std::filesystem::path &path, const std::string &value)
+    {
+        std::ofstream file(path, std::ios::trunc);
+        file << "RWStructuredBuffer<uint> output;\n"
+                "[shader(\"compute\")]\n"
+                "[numthreads(1, 1, 1)]\n"
+                "void main(uint3 id : SV_DispatchThreadID)\n"
+                "{\n"
+                "    output[id.x] = " + value + "u;\n"
+                "}\n";
+    }
+
+    // Connects with a plain socket, so a fallback to in-process compilation cannot pass
+    // the test on its own
+    bool isServerListening(const std::string &socketPath)
+    {
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (socketPath.size() >= sizeof(address.sun_path))
+            return false;
+        socketPath.copy(address.sun_path, socketPath.size());
+
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            return false;
+        bool connected = connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) == 0;
+        close(fd);
+        return connected;
+    }
+
+    uint64_t getRequestCount(SlangcCompileServer *server)
+    {
+        SlangcCompileServerStats stats = {};
+        if (slangc_getCompileServerStats(server, &stats) != SLANGC_OK)
+            return 0;
+        return stats.requestCount;
+    }
+
+    std::string compileRemote(const std::string &socketPath, const std::string &searchPath)
+    {
+        const char *searchPaths[] = {searchPath.c_str()};
+        SlangcBatchDesc desc = {};
+        desc.threadCount = 1;
+        desc.searchPaths = searchPaths;
+        desc.searchPathCount = 1;
+
+        SlangcCompileJob job = {};
+        job.moduleName = "reload";
+        job.entryPointName = "main";
+        job.stage = SLANGC_STAGE_COMPUTE;
+        job.target = SLANGC_TARGET_HLSL;
+
+        SlangcCompileJobResult result = {};
+        std::string code;
+        if (slangc_compileBatchRemote(socketPath.c_str(), &desc, &job, 1, &result) == SLANGC_OK && result.code)
+            code.assign(static_cast<const char *>(slangc_getBlobData(result.code)), slangc_getBlobSize(result.code));
+        else
+            std::fprintf(stderr, "Remote compile failed: %s\n", slangc_getLastError());
+        slangc_releaseCompileJobResults(&result, 1);
+        return code;
+    }
+}
+
+int main()
+{
+    std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                      ("slangc-server-reload-" + std::to_string(getpid()));
+    std::filesystem::create_directories(directory);
+    std::filesystem::permissions(directory, std::filesystem::perms::owner_all);
+    std::string socketPath = (directory / "server.sock").string();
+    std::filesystem::path modulePath = directory / "reload.slang";
+    writeModule(modulePath, "1111");
+
+    SlangcCompileServerDesc serverDesc = {};
+    serverDesc.socketPath = socketPath.c_str();
+    serverDesc.threadCount = 1;
+    SlangcCompileServer *server = slangc_createCompileServer(&serverDesc);
+    CHECK(server != nullptr);
+    if (!server)
+    {
+        std::fprintf(stderr, "%s\n", slangc_getLastError());
+        std::filesystem::remove_all(directory);
+        return 1;
+    }
+    std::thread serverThread([server]
+                             { slangc_runCompileServer(server); });
+    CHECK(isServerListening(socketPath));
+
+    std::string first = compileRemote(socketPath, directory.string());
+    CHECK(first.find("1111") != std::string::npos);
+    CHECK(getRequestCount(server) == 1);
+
+    writeModule(modulePath, "22222");
+    std::string second = compileRemote(socketPath, directory.string());
+    CHECK(second.find("22222") != std::string::npos);
+    CHECK(second.find("1111") == std::string::npos);
+    CHECK(getRequestCount(server) == 2);
+
+    slangc_stopCompileServer(server);
+    serverThread.join();
+    slangc_releaseCompileServer(server);
+    slangc_shutdown();
+    std::filesystem::remove_all(directory);
+
+    if (g_failures > 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("server_reload: ok\n");
+    return 0;
+}
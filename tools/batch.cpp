@@ -0,0 +1,557 @@
+// Parallel batch compiler for the slangc wrapper.
+//
+// Reads a manifest of modules, entry points, targets and macro sets, compiles every
+// combination on a compile executor backed by a session pool, and writes the code and a
+// Makefile depfile for each output. Per-job timing and a per-thread summary are printed
+// afterwards, so the same run doubles as a throughput benchmark.
+//
+// Manifest (one directive per line, '#' starts a comment):
+//   search DIR                   Add a module search path (relative to the manifest)
+//   cache DIR                    Persistent compiled-code cache directory
+//   target NAME                  Compile every entry point for this target (spirv, dxil, ...)
+//   macros NAME [DEF...]         Compile every entry point with this macro set; each DEF
+//                                is "NAME" or "NAME=VALUE" (no sets compiles once, without macros)
+//   module NAME                  Module that the entry lines below belong to
+//   entry NAME STAGE             Entry point of the current module (vertex, fragment, compute, ...)
+//
+// Outputs are named OUT_DIR/MODULE[.MACROS].ENTRY.EXT, with the depfile beside them.
+//
+// Usage: slangc-batch [options] MANIFEST
+//   --out-dir DIR          Directory to write outputs and depfiles to (default .)
+//   --jobs N               Compile threads (default one per hardware thread)
+//   --cache DIR            Cache directory, overriding the manifest
+//   --no-cache             Do not use the compiled-code cache
+//   --no-depfiles          Do not write depfiles
+
+#include "slangc.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Options
+    {
+        std::string manifestPath;
+        std::string outDir = ".";
+        int jobs = 0;
+        std::string cacheDir;
+        bool noCache = false;
+        bool depfiles = true;
+    };
+
+    struct EntryPoint
+    {
+        std::string name;
+        SlangcStage stage;
+    };
+
+    struct Module
+    {
+        std::string name;
+        std::vector<EntryPoint> entryPoints;
+    };
+
+    struct MacroSet
+    {
+        std::string name;
+        std::vector<std::string> definitions;
+        std::vector<const char *> pointers;
+    };
+
+    struct TargetInfo
+    {
+        const char *name;
+        SlangcCompileTarget target;
+        const char *extension;
+    };
+
+    struct Manifest
+    {
+        std::vector<std::string> searchPaths;
+        std::string cacheDir;
+        std::vector<const TargetInfo *> targets;
+        std::vector<MacroSet> macroSets;
+        std::vector<Module> modules;
+    };
+
+    const TargetInfo kTargets[] = {
+        {"hlsl", SLANGC_TARGET_HLSL, "hlsl"},
+        {"glsl", SLANGC_TARGET_GLSL, "glsl"},
+        {"spirv", SLANGC_TARGET_SPIRV, "spv"},
+        {"spirv-asm", SLANGC_TARGET_SPIRV_ASM, "spvasm"},
+        {"dxbc", SLANGC_TARGET_DXBC, "dxbc"},
+        {"dxil", SLANGC_TARGET_DXIL, "dxil"},
+        {"cpp", SLANGC_TARGET_CPP_SOURCE, "cpp"},
+        {"cuda", SLANGC_TARGET_CUDA_SOURCE, "cu"},
+        {"ptx", SLANGC_TARGET_PTX, "ptx"},
+        {"metal", SLANGC_TARGET_METAL, "metal"},
+        {"metallib", SLANGC_TARGET_METAL_LIB, "metallib"},
+        {"wgsl", SLANGC_TARGET_WGSL, "wgsl"},
+    };
+
+    struct StageInfo
+    {
+        const char *name;
+        SlangcStage stage;
+    };
+
+    const StageInfo kStages[] = {
+        {"vertex", SLANGC_STAGE_VERTEX},
+        {"hull", SLANGC_STAGE_HULL},
+        {"domain", SLANGC_STAGE_DOMAIN},
+        {"geometry", SLANGC_STAGE_GEOMETRY},
+        {"fragment", SLANGC_STAGE_FRAGMENT},
+        {"compute", SLANGC_STAGE_COMPUTE},
+        {"raygeneration", SLANGC_STAGE_RAY_GENERATION},
+        {"intersection", SLANGC_STAGE_INTERSECTION},
+        {"anyhit", SLANGC_STAGE_ANY_HIT},
+        {"closesthit", SLANGC_STAGE_CLOSEST_HIT},
+        {"miss", SLANGC_STAGE_MISS},
+        {"callable", SLANGC_STAGE_CALLABLE},
+        {"mesh", SLANGC_STAGE_MESH},
+        {"amplification", SLANGC_STAGE_AMPLIFICATION},
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    // One output and the timing its ticket recorded
+    struct Job
+    {
+        std::string label;
+        std::string outputPath;
+        std::string depfilePath;
+        SlangcCompileJob job = {};
+        SlangcCompileTicket *ticket = nullptr;
+
+        std::thread::id worker;
+        Clock::time_point started;
+        Clock::time_point finished;
+        double milliseconds = 0.0; // Run time on the executor thread, excluding time queued
+    };
+
+    // Runs on the executor thread right after the job's compile; the ticket's run time
+    // places the start on the same clock
+    void onJobFinished(SlangcCompileTicket *ticket, void *userData)
+    {
+        Job *job = static_cast<Job *>(userData);
+        job->worker = std::this_thread::get_id();
+        job->finished = Clock::now();
+        job->started = job->finished;
+        double runMs = 0.0;
+        if (slangc_getCompileTicketTiming(ticket, nullptr, &runMs) == SLANGC_OK)
+        {
+            job->milliseconds = runMs;
+            job->started -= std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(runMs));
+        }
+    }
+
+    bool parseManifest(const std::string &path, Manifest &manifest)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open manifest %s\n", path.c_str());
+            return false;
+        }
+
+        std::filesystem::path base = std::filesystem::path(path).parent_path();
+        std::string line;
+        for (int lineNumber = 1; std::getline(file, line); lineNumber++)
+        {
+            line = line.substr(0, line.find('#'));
+            std::istringstream tokens(line);
+            std::string directive;
+            if (!(tokens >> directive))
+                continue;
+
+            std::string name;
+            tokens >> name;
+            auto fail = [&](const char *message)
+            {
+                std::fprintf(stderr, "%s:%d: %s\n", path.c_str(), lineNumber, message);
+                return false;
+            };
+            if (name.empty())
+                return fail("missing argument");
+
+            if (directive == "search")
+                manifest.searchPaths.push_back((base / name).lexically_normal().string());
+            else if (directive == "cache")
+                manifest.cacheDir = (base / name).lexically_normal().string();
+            else if (directive == "target")
+            {
+                auto found = std::find_if(std::begin(kTargets), std::end(kTargets), [&](const TargetInfo &target)
+                                          { return name == target.name; });
+                if (found == std::end(kTargets))
+                    return fail("unknown target");
+                manifest.targets.push_back(found);
+            }
+            else if (directive == "macros")
+            {
+                MacroSet macroSet;
+                macroSet.name = name;
+                for (std::string definition; tokens >> definition;)
+                    macroSet.definitions.push_back(definition);
+                manifest.macroSets.push_back(std::move(macroSet));
+            }
+            else if (directive == "module")
+                manifest.modules.push_back({name, {}});
+            else if (directive == "entry")
+            {
+                std::string stageName;
+                tokens >> stageName;
+                auto found = std::find_if(std::begin(kStages), std::end(kStages), [&](const StageInfo &stage)
+                                          { return stageName == stage.name; });
+                if (found == std::end(kStages))
+                    return fail("unknown stage");
+                if (manifest.modules.empty())
+                    return fail("entry before any module");
+                manifest.modules.back().entryPoints.push_back({name, found->stage});
+            }
+            else
+                return fail("unknown directive");
+        }
+
+        if (manifest.macroSets.empty())
+            manifest.macroSets.push_back({});
+        for (auto &macroSet : manifest.macroSets)
+        {
+            for (const auto &definition : macroSet.definitions)
+                macroSet.pointers.push_back(definition.c_str());
+        }
+        return true;
+    }
+
+    // One job per (module, macro set, target, entry point), ordered so that jobs sharing
+    // a session and module are queued together
+    std::vector<Job> createJobs(const Options &options, const Manifest &manifest)
+    {
+        size_t jobCount = 0;
+        for (const auto &module : manifest.modules)
+            jobCount += module.entryPoints.size() * manifest.macroSets.size() * manifest.targets.size();
+
+        // Reserved up front, since each job points into its own strings
+        std::vector<Job> jobs;
+        jobs.reserve(jobCount);
+        std::filesystem::path outDir(options.outDir);
+        for (const auto &module : manifest.modules)
+        {
+            for (const auto &macroSet : manifest.macroSets)
+            {
+                for (const TargetInfo *target : manifest.targets)
+                {
+                    for (const auto &entryPoint : module.entryPoints)
+                    {
+                        std::string stem = module.name;
+                        if (!macroSet.name.empty())
+                            stem += "." + macroSet.name;
+                        stem += "." + entryPoint.name;
+
+                        Job &job = jobs.emplace_back();
+                        job.label = stem + " [" + target->name + "]";
+                        job.outputPath = (outDir / (stem + "." + target->extension)).string();
+                        job.depfilePath = job.outputPath + ".d";
+
+                        job.job.moduleName = module.name.c_str();
+                        job.job.entryPointName = entryPoint.name.c_str();
+                        job.job.stage = entryPoint.stage;
+                        job.job.target = target->target;
+                        job.job.preprocessorMacros = macroSet.pointers.empty() ? nullptr : const_cast<const char **>(macroSet.pointers.data());
+                        job.job.preprocessorMacroCount = static_cast<int32_t>(macroSet.pointers.size());
+                        job.job.depfilePath = options.depfiles ? job.depfilePath.c_str() : nullptr;
+                        job.job.outputPath = job.outputPath.c_str();
+                    }
+                }
+            }
+        }
+        return jobs;
+    }
+
+    // Writes beside the output and renames into place, so an interrupted run never
+    // leaves a truncated output that looks newer than its sources
+    bool writeOutput(const std::string &path, SlangcBlob *code)
+    {
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            file.write(static_cast<const char *>(slangc_getBlobData(code)), static_cast<std::streamsize>(slangc_getBlobSize(code)));
+            file.close();
+            if (file)
+            {
+                std::error_code ec;
+                std::filesystem::rename(tempPath, path, ec);
+                if (!ec)
+                    return true;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+
+    // Job times are measured by the executor around each compile. The summary lists the
+    // jobs of the thread that finished last, in the order they happened to run; jobs do
+    // not depend on each other, so there is no critical path beyond that.
+    void printTiming(const std::vector<Job> &jobs, Clock::time_point start, Clock::time_point end, int threadCount)
+    {
+        std::vector<const Job *> sorted;
+        double totalMs = 0.0;
+        double longestMs = 0.0;
+        for (const auto &job : jobs)
+        {
+            sorted.push_back(&job);
+            totalMs += job.milliseconds;
+            longestMs = std::max(longestMs, job.milliseconds);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const Job *a, const Job *b)
+                  { return a->milliseconds > b->milliseconds; });
+
+        // Jobs whose ticket could not be created never ran and have no times
+        std::printf("%10s  %10s  %s\n", "start ms", "ms", "job");
+        for (const Job *job : sorted)
+        {
+            if (job->finished == Clock::time_point())
+            {
+                std::printf("%10s  %10s  %s\n", "-", "-", job->label.c_str());
+                continue;
+            }
+            double startMs = std::chrono::duration<double, std::milli>(job->started - start).count();
+            std::printf("%10.3f  %10.3f  %s\n", startMs, job->milliseconds, job->label.c_str());
+        }
+
+        double wallMs = std::chrono::duration<double, std::milli>(end - start).count();
+        double boundMs = std::max(longestMs, totalMs / threadCount);
+        std::printf("\n%zu job(s) on %d thread(s): %.3f ms wall, %.3f ms of compile work, %.1f%% utilization\n",
+                    jobs.size(), threadCount, wallMs, totalMs, wallMs > 0.0 ? 100.0 * totalMs / (wallMs * threadCount) : 0.0);
+        std::printf("Lower bound %.3f ms (longest job %.3f ms, even split %.3f ms)\n",
+                    boundMs, longestMs, totalMs / threadCount);
+
+        std::map<std::thread::id, std::vector<const Job *>> workers;
+        for (const auto &job : jobs)
+        {
+            if (job.finished != Clock::time_point())
+                workers[job.worker].push_back(&job);
+        }
+
+        const std::vector<const Job *> *lastWorker = nullptr;
+        Clock::time_point lastEnd = start;
+        for (auto &[worker, workerJobs] : workers)
+        {
+            std::sort(workerJobs.begin(), workerJobs.end(), [](const Job *a, const Job *b)
+                      { return a->started < b->started; });
+            if (!lastWorker || workerJobs.back()->finished > lastEnd)
+            {
+                lastWorker = &workerJobs;
+                lastEnd = workerJobs.back()->finished;
+            }
+        }
+        if (!lastWorker)
+            return;
+
+        double busyMs = 0.0;
+        for (const Job *job : *lastWorker)
+            busyMs += job->milliseconds;
+        double spanMs = std::chrono::duration<double, std::milli>(lastEnd - start).count();
+        std::printf("Last thread to finish: %zu job(s), %.3f ms busy, %.3f ms idle or waiting\n",
+                    lastWorker->size(), busyMs, std::max(0.0, spanMs - busyMs));
+        for (const Job *job : *lastWorker)
+        {
+            double startMs = std::chrono::duration<double, std::milli>(job->started - start).count();
+            std::printf("%10.3f  %10.3f  %s\n", startMs, job->milliseconds, job->label.c_str());
+        }
+    }
+
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const char *arg = argv[i];
+            if (std::strcmp(arg, "--no-cache") == 0)
+            {
+                options.noCache = true;
+                continue;
+            }
+            if (std::strcmp(arg, "--no-depfiles") == 0)
+            {
+                options.depfiles = false;
+                continue;
+            }
+            if (arg[0] != '-')
+            {
+                options.manifestPath = arg;
+                continue;
+            }
+
+            const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+            if (!value)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", arg);
+                return false;
+            }
+            if (std::strcmp(arg, "--out-dir") == 0)
+                options.outDir = argv[++i];
+            else if (std::strcmp(arg, "--jobs") == 0)
+                options.jobs = std::max(1, std::atoi(argv[++i]));
+            else if (std::strcmp(arg, "--cache") == 0)
+                options.cacheDir = argv[++i];
+            else
+            {
+                std::fprintf(stderr, "Unknown option %s\n", arg);
+                return false;
+            }
+        }
+
+        if (options.manifestPath.empty())
+        {
+            std::fprintf(stderr, "Usage: slangc-batch [options] MANIFEST\n");
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return 1;
+
+    Manifest manifest;
+    if (!parseManifest(options.manifestPath, manifest))
+        return 1;
+    if (manifest.targets.empty())
+    {
+        std::fprintf(stderr, "The manifest names no target\n");
+        return 1;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(options.outDir, ec);
+
+    // The cache is optional: a build without one is only slower
+    SlangcCache *cache = nullptr;
+    std::string cacheDir = options.cacheDir.empty() ? manifest.cacheDir : options.cacheDir;
+    if (!options.noCache && !cacheDir.empty())
+    {
+        SlangcCacheDesc cacheDesc = {};
+        cacheDesc.directory = cacheDir.c_str();
+        cacheDesc.cacheModules = true;
+        cache = slangc_createCache(&cacheDesc);
+        if (!cache)
+            std::fprintf(stderr, "Compiling without a cache: %s\n", slangc_getLastError());
+    }
+
+    int threadCount = options.jobs > 0 ? options.jobs : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<const char *> searchPaths;
+    for (const auto &path : manifest.searchPaths)
+        searchPaths.push_back(path.c_str());
+
+    SlangcSessionPoolDesc poolDesc = {};
+    poolDesc.maxGlobalSessions = threadCount;
+    SlangcSessionPool *pool = slangc_createSessionPool(&poolDesc);
+    if (!pool)
+    {
+        std::fprintf(stderr, "Failed to create session pool: %s\n", slangc_getLastError());
+        return 1;
+    }
+
+    SlangcCompileExecutorDesc executorDesc = {};
+    executorDesc.pool = pool;
+    executorDesc.threadCount = threadCount;
+    executorDesc.searchPaths = searchPaths.data();
+    executorDesc.searchPathCount = static_cast<int32_t>(searchPaths.size());
+    executorDesc.cache = cache;
+
+    std::vector<Job> jobs = createJobs(options, manifest);
+    SlangcCompileExecutor *executor = slangc_createCompileExecutor(&executorDesc);
+    if (!executor)
+    {
+        std::fprintf(stderr, "Failed to create compile executor: %s\n", slangc_getLastError());
+        slangc_releaseSessionPool(pool);
+        return 1;
+    }
+
+    // Create every global session before the clock starts, so the timing covers
+    // compiles rather than Slang startup
+    std::vector<SlangcGlobalSession *> warmSessions;
+    for (int i = 0; i < threadCount; i++)
+    {
+        if (SlangcGlobalSession *globalSession = slangc_acquireGlobalSession(pool))
+            warmSessions.push_back(globalSession);
+    }
+    for (SlangcGlobalSession *globalSession : warmSessions)
+        slangc_returnGlobalSession(pool, globalSession);
+
+    Clock::time_point start = Clock::now();
+    for (auto &job : jobs)
+        job.ticket = slangc_compileAsync(executor, &job.job, 0, onJobFinished, &job);
+    for (auto &job : jobs)
+    {
+        if (job.ticket)
+            slangc_waitCompileTicket(job.ticket, SLANGC_WAIT_INFINITE);
+    }
+    Clock::time_point end = Clock::now();
+
+    // Every callback has run once the executor is released
+    slangc_releaseCompileExecutor(executor);
+
+    int failures = 0;
+    for (auto &job : jobs)
+    {
+        SlangcCompileJobResult result = {};
+        if (!job.ticket || slangc_takeCompileTicketResult(job.ticket, &result) != SLANGC_OK)
+            result.result = SLANGC_FAIL;
+
+        if (result.diagnostics && slangc_getBlobSize(result.diagnostics) > 0)
+        {
+            std::fprintf(stderr, "%s:\n%.*s\n", job.label.c_str(), static_cast<int>(slangc_getBlobSize(result.diagnostics)),
+                         static_cast<const char *>(slangc_getBlobData(result.diagnostics)));
+        }
+        if (result.result != SLANGC_OK || !result.code)
+        {
+            std::fprintf(stderr, "%s: compile failed\n", job.label.c_str());
+            failures++;
+        }
+        else if (!writeOutput(job.outputPath, result.code))
+        {
+            std::fprintf(stderr, "%s: failed to write %s\n", job.label.c_str(), job.outputPath.c_str());
+            failures++;
+
+            // The depfile names an output that was not written, so it must not tell the
+            // build system the output is up to date
+            std::error_code ec;
+            std::filesystem::remove(job.depfilePath, ec);
+        }
+
+        slangc_releaseCompileJobResults(&result, 1);
+        slangc_releaseCompileTicket(job.ticket);
+    }
+
+    printTiming(jobs, start, end, threadCount);
+
+    SlangcCacheStats stats = {};
+    if (cache && slangc_getCacheStats(cache, &stats) == SLANGC_OK)
+    {
+        std::printf("Cache: %llu hit(s), %llu miss(es), %llu module hit(s), %llu module miss(es)\n",
+                    static_cast<unsigned long long>(stats.hitCount), static_cast<unsigned long long>(stats.missCount),
+                    static_cast<unsigned long long>(stats.moduleHitCount), static_cast<unsigned long long>(stats.moduleMissCount));
+    }
+    if (failures > 0)
+        std::printf("%d of %zu job(s) failed\n", failures, jobs.size());
+
+    slangc_releaseCache(cache);
+    slangc_releaseSessionPool(pool);
+    slangc_shutdown();
+    return failures > 0 ? 1 : 0;
+}
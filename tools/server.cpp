@@ -0,0 +1,111 @@
+// Compile server for the slangc wrapper.
+//
+// Keeps global sessions, sessions and checked modules warm and serves batch compiles
+// from slangc_compileBatchRemote over a Unix domain socket, so short-lived tools and
+// editor integrations skip Slang startup. Stops on SIGINT or SIGTERM.
+//
+// Usage: slangc-server [options]
+//   --socket PATH          Socket to listen on (default as for slangc_compileBatchRemote)
+//   --jobs N               Compile threads per set of session settings (default one per hardware thread)
+//   --cache DIR            Persistent compiled-code cache directory
+//   --max-executors N      Sets of session settings kept warm at once (default 4)
+
+#include "slangc.h"
+
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+    struct Options
+    {
+        std::string socketPath;
+        int jobs = 0;
+        std::string cacheDir;
+        int maxExecutors = 0;
+    };
+
+    SlangcCompileServer *g_server = nullptr;
+
+    void onStopSignal(int)
+    {
+        slangc_stopCompileServer(g_server);
+    }
+
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const char *arg = argv[i];
+            const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+            if (!value)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", arg);
+                return false;
+            }
+            if (std::strcmp(arg, "--socket") == 0)
+                options.socketPath = argv[++i];
+            else if (std::strcmp(arg, "--jobs") == 0)
+                options.jobs = std::max(1, std::atoi(argv[++i]));
+            else if (std::strcmp(arg, "--cache") == 0)
+                options.cacheDir = argv[++i];
+            else if (std::strcmp(arg, "--max-executors") == 0)
+                options.maxExecutors = std::max(1, std::atoi(argv[++i]));
+            else
+            {
+                std::fprintf(stderr, "Unknown option %s\n", arg);
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+        return 1;
+
+    SlangcCache *cache = nullptr;
+    if (!options.cacheDir.empty())
+    {
+        SlangcCacheDesc cacheDesc = {};
+        cacheDesc.directory = options.cacheDir.c_str();
+        cacheDesc.cacheModules = true;
+        cache = slangc_createCache(&cacheDesc);
+        if (!cache)
+            std::fprintf(stderr, "Serving without a cache: %s\n", slangc_getLastError());
+    }
+
+    SlangcCompileServerDesc serverDesc = {};
+    serverDesc.socketPath = options.socketPath.empty() ? nullptr : options.socketPath.c_str();
+    serverDesc.threadCount = options.jobs;
+    serverDesc.cache = cache;
+    serverDesc.maxExecutors = options.maxExecutors;
+
+    g_server = slangc_createCompileServer(&serverDesc);
+    if (!g_server)
+    {
+        std::fprintf(stderr, "Failed to start compile server: %s\n", slangc_getLastError());
+        slangc_releaseCache(cache);
+        return 1;
+    }
+
+    std::signal(SIGINT, onStopSignal);
+    std::signal(SIGTERM, onStopSignal);
+
+    std::printf("slangc-server %s listening\n", slangc_getVersionString());
+    std::fflush(stdout);
+    SlangcResult result = slangc_runCompileServer(g_server);
+
+    slangc_releaseCompileServer(g_server);
+    g_server = nullptr;
+    slangc_releaseCache(cache);
+    slangc_shutdown();
+    return result == SLANGC_OK ? 0 : 1;
+}